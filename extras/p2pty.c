@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * p2pty.c
+ *
+ * Creation Date: October 19, 2026
+ * Author(s):
+ *
+ *
+ * Copyright (c) 2026, SpectSoft
+ *   All Rights Reserved.
+ *   http://www.spectsoft.com/
+ *   info@spectsoft.com
+ *
+ * $Id$
+ *
+ * DESC: Tests the p2slave tty line discipline on a pty pair.  The
+ *       discipline is attached to the pty slave and the master plays the
+ *       P2 controller, sending Device Type Requests and timing the replies.
+ *       It then sends a lone byte, waits past the inter-byte timeout and
+ *       checks that the next command is still answered.  Needs the p2slave
+ *       module loaded with its ldisc parameter set.
+ *
+ *       Build: cc -O2 -I../include -I../src -o p2pty p2pty.c
+ *       Usage: p2pty [-n count] [-d ldisc]
+ *
+ ******************************************************************************/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <termios.h>
+#include <sys/ioctl.h>
+#include <sys/time.h>
+
+#include <p2slave.h>
+
+#define PTY_REPLY_MS 		100		/* Give up on a reply after this long */
+#define PTY_GAP_US 		20000		/* Longer than the discipline's inter-byte timeout */
+
+static const uint8_t pkt_devtype[] = {0x00, 0x11, 0x11};
+
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec / 1000000000.0;
+}
+
+/* Reads one reply packet from the master side, returns its size or -1 on timeout */
+static int read_reply(int fd, uint8_t *buf) {
+	struct pollfd pfd = { fd, POLLIN, 0 };
+	int got = 0, size = 3, n;
+	while(got < size) {
+		if(poll(&pfd, 1, PTY_REPLY_MS) <= 0) return -1;
+		n = read(fd, buf + got, size - got);
+		if(n <= 0) return -1;
+		got += n;
+		if(got >= 1) size = (buf[0] & 0x0F) + 3;
+	}
+	return size;
+}
+
+static void print_pkt(const char *name, const uint8_t *buf, int size) {
+	int i;
+	printf("%s", name);
+	for(i = 0; i < size; i++) printf(" %02X", buf[i]);
+	printf("\n");
+	return;
+}
+
+static void usage(const char *name) {
+	fprintf(stderr, "Usage: %s [-n count] [-d ldisc]\n", name);
+	fprintf(stderr, "  -n count  Device Type Requests to time, default 1000\n");
+	fprintf(stderr, "  -d ldisc  Line discipline number, default from %s\n", P2SLAVE_LDISC_PARAM);
+	return;
+}
+
+/* The number the loaded module registered, -1 if it didn't */
+static int loaded_ldisc(void) {
+	FILE *f = fopen(P2SLAVE_LDISC_PARAM, "r");
+	int disc = -1;
+	if(f == NULL) return -1;
+	if(fscanf(f, "%d", &disc) != 1) disc = -1;
+	fclose(f);
+	return disc;
+}
+
+int main(int argc, char **argv) {
+	int count = 1000, disc = -1, index = -1, opt, master, slave, i, size, fail = 0;
+	double t, rtt, min = 1.0, max = 0.0, total = 0.0;
+	struct termios tio;
+	uint8_t reply[32];
+
+	while((opt = getopt(argc, argv, "n:d:")) != -1) {
+		switch(opt) {
+			case 'n': count = atoi(optarg); break;
+			case 'd': disc = atoi(optarg); break;
+			default: usage(argv[0]); return 1;
+		}
+	}
+	if(count < 1) {
+		usage(argv[0]);
+		return 1;
+	}
+	if(disc < 0) disc = loaded_ldisc();
+	if(disc < 0) {
+		fprintf(stderr, "The p2slave line discipline isn't registered, load the module with ldisc=<n>\n");
+		return 1;
+	}
+
+	master = posix_openpt(O_RDWR | O_NOCTTY);
+	if(master < 0 || grantpt(master) || unlockpt(master)) {
+		perror("Unable to open a pty");
+		return 1;
+	}
+	slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+	if(slave < 0) {
+		perror(ptsname(master));
+		return 1;
+	}
+
+	// Raw on both ends, and the RS-422 line settings for when it's a real port
+	tcgetattr(master, &tio);
+	cfmakeraw(&tio);
+	tcsetattr(master, TCSANOW, &tio);
+	tcgetattr(slave, &tio);
+	cfmakeraw(&tio);
+	cfsetispeed(&tio, B38400);
+	cfsetospeed(&tio, B38400);
+	tio.c_cflag |= CS8 | PARENB | PARODD | CLOCAL | CREAD;
+	tcsetattr(slave, TCSANOW, &tio);
+
+	if(ioctl(slave, TIOCSETD, &disc)) {
+		perror("Unable to attach the p2slave line discipline");
+		return 1;
+	}
+	if(ioctl(slave, P2SLAVE_TIOCGINDEX, &index)) perror("P2SLAVE_TIOCGINDEX");
+	printf("%s attached as p2slave%d\n", ptsname(master), index);
+
+	for(i = 0; i < count; i++) {
+		t = now();
+		if(write(master, pkt_devtype, sizeof(pkt_devtype)) != sizeof(pkt_devtype)) {
+			perror("write");
+			return 1;
+		}
+		size = read_reply(master, reply);
+		rtt = now() - t;
+		if(size < 0) {
+			fprintf(stderr, "No reply to request %d\n", i);
+			return 2;
+		}
+		if(i == 0) print_pkt("Device Type:", reply, size);
+		if(reply[0] != 0x12 || reply[1] != 0x11) fail = 1;
+		if(rtt < min) min = rtt;
+		if(rtt > max) max = rtt;
+		total += rtt;
+	}
+	printf("%d requests, round trip min %.1f us, avg %.1f us, max %.1f us\n", count,
+		min * 1000000.0, total / count * 1000000.0, max * 1000000.0);
+
+	// A lone byte the discipline has to drop, or the next request is misframed
+	if(write(master, pkt_devtype, 1) != 1) {
+		perror("write");
+		return 1;
+	}
+	usleep(PTY_GAP_US);
+	if(write(master, pkt_devtype, sizeof(pkt_devtype)) != sizeof(pkt_devtype)) {
+		perror("write");
+		return 1;
+	}
+	size = read_reply(master, reply);
+	if(size < 0 || reply[0] != 0x12 || reply[1] != 0x11) {
+		if(size > 0) print_pkt("After timeout:", reply, size);
+		fprintf(stderr, "Part received command was not dropped\n");
+		fail = 1;
+	} else {
+		printf("Part received command dropped\n");
+	}
+
+	close(slave);
+	close(master);
+	if(fail) printf("FAILED\n");
+	return fail ? 2 : 0;
+}
@@ -44,6 +44,11 @@ while(<REGINFO>) {
 					} else {
 						$registers{$name}{'stateful'} = 0;
 					}
+					if ($rw =~ /c/) {
+						$registers{$name}{'cacheable'} = 1;
+					} else {
+						$registers{$name}{'cacheable'} = 0;
+					}
 					$registers{$name}{'type'} = $type;
 					$level ++;
 				} else {
@@ -95,6 +100,10 @@ if ($ARGV[0] eq 'header') {
 	writeHeader();
 } elsif($ARGV[0] eq 'strings') {
 	writeRegStrings();
+} elsif($ARGV[0] eq 'shadow') {
+	writeShadow();
+} elsif($ARGV[0] eq 'accessors') {
+	writeAccessors();
 }
 exit 0;
 
@@ -205,3 +214,142 @@ sub writeRegStrings {
 	print "\n#endif /* _AJA_REGSTRINGS_H_ defined */\n\n";
 }
 
+
+# A card register can be shadowed if every bit that can be read back and written
+# is owned by the driver (stateful or cacheable).  Write only bits are written
+# through but never kept in the shadow.
+sub writeShadow {
+	my %keep;
+	my %cached;
+	my $maxreg = 0;
+
+	foreach $name (keys %registers) {
+		$reg = $registers{$name}{'cardreg'};
+		$start = $registers{$name}{'start'};
+		$end = $registers{$name}{'end'};
+		if ($reg > $maxreg) { $maxreg = $reg; }
+		if (!defined($keep{$reg})) { $keep{$reg} = 0; }
+		if (!$registers{$name}{'writable'}) { next; }
+		if (!defined($cached{$reg})) { $cached{$reg} = 1; }
+		if (!$registers{$name}{'readable'}) { next; }
+
+		if ($registers{$name}{'stateful'} || $registers{$name}{'cacheable'}) {
+			for($i = $start; $i <= $end; $i++) {
+				$keep{$reg} |= (1 << $i);
+			}
+		} else {
+			$cached{$reg} = 0;
+		}
+	}
+
+	print "/* AJA CARD SHADOW REGISTERS \n";
+	print " * THIS FILE IS AUTOMATICALY GENERATED BY THE SPECTSOFT AJA-DRIVER PACKAGE */\n\n\n";
+	print "#ifndef _AJA_SHADOW_H_\n";
+	print "#define _AJA_SHADOW_H_\n\n\n";
+
+	print "#ifndef __KERNEL__\n";
+	print "#include <stdint.h>\n";
+	print "#endif\n\n";
+
+	printf("#define AJA_SHADOW_REGS %d\n\n", $maxreg + 1);
+
+	print "/* Is the card register written from the shadow (1) or read-modify-written (0) */\n";
+	print "static const uint8_t aja_shadow_cached[AJA_SHADOW_REGS] = {\n";
+	for($reg = 0; $reg <= $maxreg; $reg++) {
+		printf("\t%d,\t/* Reg %d */\n", $cached{$reg} ? 1 : 0, $reg);
+	}
+	print "};\n\n";
+
+	print "/* Bits of each card register kept in the shadow */\n";
+	print "static const uint32_t aja_shadow_keep[AJA_SHADOW_REGS] = {\n";
+	for($reg = 0; $reg <= $maxreg; $reg++) {
+		printf("\t0x%08Xu,\t/* Reg %d */\n", $cached{$reg} ? $keep{$reg} : 0, $reg);
+	}
+	print "};\n\n";
+
+	print "\n#endif /* _AJA_SHADOW_H_ defined */\n\n";
+}
+
+
+# Byte address, mask and shift of a register field, for the accessors
+sub accessorField {
+	my ($name) = @_;
+	my ($i, $mask) = (0, 0);
+	my $start = $registers{$name}{'start'};
+	for($i = $start; $i <= $registers{$name}{'end'}; $i++) {
+		$mask += (1 << $i);
+	}
+	return ($registers{$name}{'cardreg'} * 4, $mask, $start);
+}
+
+
+# Per register inline accessors.  The address, shift and mask are constants, so
+# every accessor compiles down to the MMIO access itself.  Registers past the
+# small register space also get a _small variant for boards that don't have them.
+sub writeAccessors {
+	print "/* AJA CARD REGISTER ACCESSORS \n";
+	print " * THIS FILE IS AUTOMATICALY GENERATED BY THE SPECTSOFT AJA-DRIVER PACKAGE */\n\n\n";
+	print "#ifndef _AJA_REGACCESS_H_\n";
+	print "#define _AJA_REGACCESS_H_\n\n\n";
+
+	print "#ifndef __KERNEL__\n";
+	print "#include <stdint.h>\n";
+	print "#endif\n\n";
+
+	print "/* The includer may define the register context and the access macros.  The default\n";
+	print " * is a userspace pointer to the mmap'ed register space (BAR0), which is read only:\n";
+	print " * userspace writes go through the driver so its shadow registers stay right */\n";
+	print "#ifndef AJA_REGCTX\n";
+	print "#define AJA_REGCTX const volatile uint32_t *\n";
+	print "#define AJA_REGREAD(c, add) ((c)[(add) / 4])\n";
+	print "#endif\n\n";
+
+
+	foreach $name (sort keys %registers) {
+		next if(!$registers{$name}{'readable'});
+		($add, $mask, $start) = accessorField($name);
+
+		print "/* $registers{$name}{'pname'} (Reg $registers{$name}{'cardreg'}, bits $start to $registers{$name}{'end'}) */\n";
+		if($mask == 0xFFFFFFFF) {
+			printf("static inline uint32_t ajareg_get_$name(AJA_REGCTX c) { return AJA_REGREAD(c, 0x%Xu); }\n", $add);
+		} elsif($start == 0) {
+			printf("static inline uint32_t ajareg_get_$name(AJA_REGCTX c) { return AJA_REGREAD(c, 0x%Xu) & 0x%08Xu; }\n", $add, $mask);
+		} else {
+			printf("static inline uint32_t ajareg_get_$name(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x%Xu) & 0x%08Xu) >> %d; }\n", $add, $mask, $start);
+		}
+
+		# Small register board variants
+		if($add > 0xFF) {
+			print "static inline uint32_t ajareg_get_${name}_small(AJA_REGCTX c) { return 0; }\n";
+		} else {
+			print "#define ajareg_get_${name}_small ajareg_get_$name\n";
+		}
+		print "\n";
+	}
+
+	print "\n/* Setters, only for a context that defines the write macros (the driver) */\n";
+	print "#ifdef AJA_REGWRITE\n\n";
+	foreach $name (sort keys %registers) {
+		next if(!$registers{$name}{'writable'});
+		($add, $mask, $start) = accessorField($name);
+
+		print "/* $registers{$name}{'pname'} (Reg $registers{$name}{'cardreg'}, bits $start to $registers{$name}{'end'}) */\n";
+		if($mask == 0xFFFFFFFF) {
+			printf("static inline void ajareg_set_$name(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x%Xu, v); }\n", $add);
+		} else {
+			printf("static inline void ajareg_set_$name(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x%Xu, 0x%08Xu, v << %d); }\n", $add, $mask, $start);
+		}
+
+		# Small register board variants
+		if($add > 0xFF) {
+			print "static inline void ajareg_set_${name}_small(AJA_REGCTX c, uint32_t v) { }\n";
+		} else {
+			print "#define ajareg_set_${name}_small ajareg_set_$name\n";
+		}
+		print "\n";
+	}
+	print "#endif /* AJA_REGWRITE */\n";
+
+	print "\n#endif /* _AJA_REGACCESS_H_ defined */\n\n";
+}
+
@@ -0,0 +1,252 @@
+/*******************************************************************************
+ * regreplay.c
+ *
+ * Creation Date: October 19, 2026
+ * Author(s):
+ *
+ *
+ * Copyright (c) 2026, SpectSoft
+ *   All Rights Reserved.
+ *   http://www.spectsoft.com/
+ *   info@spectsoft.com
+ *
+ * $Id$
+ *
+ * DESC: Replays a driver register trace (debugfs aja/regtrace, see
+ *       aja_regtrace.h) against a simulated register file.  Writes update the
+ *       simulated registers and reads of driver owned (shadowed) bits are
+ *       checked against them, so a field the hardware changed behind the
+ *       shadow shows up as a mismatch.  Also reports the register accesses
+ *       per output frame, where a frame starts at each hard IRQ read of the
+ *       interrupt status register that has the output vertical bit set.  There is one simulated register file,
+ *       so a trace of more than one card needs -c to pick the card.
+ *
+ *       Build: cc -O2 -I../include -o regreplay regreplay.c
+ *       Usage: regreplay [-v] [-d] [-c card] tracefile
+ *
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include <aja_regtrace.h>
+#include <aja_shadow.h>
+
+#define REPLAY_REGS 		2048		/* Covers the register space and the LUTs */
+#define REPLAY_IRQSTATUS 	21		/* Read once by every hard IRQ */
+#define REPLAY_OUTPUTIRQ 	0x80000000	/* Output vertical interrupt bit of it (ajareg_outputirq) */
+#define REPLAY_TOP 		16
+
+typedef struct {
+	uint32_t 		value;		/* Simulated register value */
+	int 			known;		/* Value has been read or written */
+	uint64_t 		reads;
+	uint64_t 		writes;
+	uint64_t 		mismatch;
+} replay_reg_t;
+
+typedef struct {
+	uint64_t 		frames;
+	uint64_t 		access;		/* Accesses in the current frame */
+	uint64_t 		irqaccess;	/* Hard IRQ accesses in the current frame */
+	uint64_t 		total;
+	uint64_t 		irqtotal;
+	uint64_t 		max;
+	uint64_t 		irqmax;
+} replay_frames_t;
+
+static replay_reg_t regs[REPLAY_REGS];
+
+static const char *ctxname[] = { "proc", "soft", "hard" };
+
+static int tstamp_cmp(const void *a, const void *b) {
+	const aja_regtrace_t *ta = a, *tb = b;
+	if(ta->tstamp < tb->tstamp) return -1;
+	if(ta->tstamp > tb->tstamp) return 1;
+	return 0;
+}
+
+static int count_cmp(const void *a, const void *b) {
+	const replay_reg_t *ra = &regs[*(const int *)a], *rb = &regs[*(const int *)b];
+	uint64_t ca = ra->reads + ra->writes, cb = rb->reads + rb->writes;
+	if(ca < cb) return 1;
+	if(ca > cb) return -1;
+	return 0;
+}
+
+static aja_regtrace_t *trace_load(const char *name, uint32_t *count) {
+	aja_regtrace_hdr_t hdr;
+	aja_regtrace_t *rec;
+	FILE *f = fopen(name, "rb");
+
+	if(f == NULL) {
+		perror(name);
+		return NULL;
+	}
+	if(fread(&hdr, sizeof(hdr), 1, f) != 1 || hdr.magic != AJA_REGTRACE_MAGIC) {
+		fprintf(stderr, "%s: not a register trace\n", name);
+		fclose(f);
+		return NULL;
+	}
+	if(hdr.version != AJA_REGTRACE_VERSION || hdr.size != sizeof(aja_regtrace_t)) {
+		fprintf(stderr, "%s: trace version %u (record %u bytes), expected %u (record %zu bytes)\n",
+			name, hdr.version, hdr.size, AJA_REGTRACE_VERSION, sizeof(aja_regtrace_t));
+		fclose(f);
+		return NULL;
+	}
+	rec = malloc(sizeof(aja_regtrace_t) * (hdr.count ? hdr.count : 1));
+	if(rec == NULL) {
+		fprintf(stderr, "Unable to allocate %u records\n", hdr.count);
+		fclose(f);
+		return NULL;
+	}
+	*count = fread(rec, sizeof(aja_regtrace_t), hdr.count, f);
+	if(*count != hdr.count) fprintf(stderr, "%s: truncated, %u of %u records\n", name, *count, hdr.count);
+	fclose(f);
+	return rec;
+}
+
+static void frame_end(replay_frames_t *fr) {
+	if(fr->frames) {
+		fr->total += fr->access;
+		fr->irqtotal += fr->irqaccess;
+		if(fr->access > fr->max) fr->max = fr->access;
+		if(fr->irqaccess > fr->irqmax) fr->irqmax = fr->irqaccess;
+	}
+	fr->access = 0;
+	fr->irqaccess = 0;
+	return;
+}
+
+static void replay(const aja_regtrace_t *t, int verbose, uint64_t t0, replay_frames_t *fr) {
+	uint32_t n = t->add / 4;
+	replay_reg_t *r;
+
+	if(verbose) {
+		printf("%12.3f cpu%-2u %s pid %-6d card %u %c reg %4u 0x%08X  [0x%llx]\n",
+			(double)(t->tstamp - t0) / 1000.0, t->cpu, ctxname[t->ctx % 3], t->pid, t->card,
+			t->op == AJA_TraceWrite ? 'W' : 'R', n, t->value, (unsigned long long)t->caller);
+	}
+
+	/* UART and other IRQs read the status too, only the output vertical is a frame */
+	if(t->op == AJA_TraceRead && t->ctx == AJA_TraceHardIRQ && n == REPLAY_IRQSTATUS &&
+	   (t->value & REPLAY_OUTPUTIRQ)) {
+		frame_end(fr);
+		fr->frames++;
+	}
+	fr->access++;
+	if(t->ctx == AJA_TraceHardIRQ) fr->irqaccess++;
+
+	if(n >= REPLAY_REGS) return;
+	r = &regs[n];
+
+	if(t->op == AJA_TraceWrite) {
+		r->writes++;
+	} else {
+		r->reads++;
+		if(r->known && n < AJA_SHADOW_REGS && aja_shadow_cached[n]) {
+			uint32_t diff = (r->value ^ t->value) & aja_shadow_keep[n];
+			if(diff) {
+				r->mismatch++;
+				if(verbose) printf("  mismatch: reg %u expected 0x%08X read 0x%08X (bits 0x%08X)\n", n, r->value, t->value, diff);
+			}
+		}
+	}
+	r->value = t->value;
+	r->known = 1;
+	return;
+}
+
+static void usage(const char *name) {
+	fprintf(stderr, "Usage: %s [-v] [-d] [-c card] tracefile\n", name);
+	fprintf(stderr, "  -v       Print every access\n");
+	fprintf(stderr, "  -d       Dump the simulated register file at the end of the trace\n");
+	fprintf(stderr, "  -c card  Only replay accesses to this card, needed when the trace has more than one\n");
+	return;
+}
+
+int main(int argc, char **argv) {
+	aja_regtrace_t *rec;
+	uint32_t count, i;
+	replay_frames_t fr;
+	uint64_t reads = 0, writes = 0, mismatch = 0, ctx[3] = { 0, 0, 0 };
+	int verbose = 0, dump = 0, card = -1, opt, top[REPLAY_REGS], used = 0;
+
+	while((opt = getopt(argc, argv, "vdc:")) != -1) {
+		switch(opt) {
+			case 'v': verbose = 1; break;
+			case 'd': dump = 1; break;
+			case 'c': card = atoi(optarg); break;
+			default: usage(argv[0]); return 1;
+		}
+	}
+	if(optind >= argc) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	rec = trace_load(argv[optind], &count);
+	if(rec == NULL) return 1;
+	qsort(rec, count, sizeof(aja_regtrace_t), tstamp_cmp);
+
+	/* The cards' registers would all land in the one register file */
+	if(card < 0) {
+		for(i = 1; i < count && rec[i].card == rec[0].card; i++);
+		if(i < count) {
+			fprintf(stderr, "The trace has accesses to cards %d and %d, pick one with -c\n",
+				rec[0].card, rec[i].card);
+			free(rec);
+			return 1;
+		}
+	}
+
+	memset(&fr, 0, sizeof(fr));
+	for(i = 0; i < count; i++) {
+		if(card >= 0 && rec[i].card != card) continue;
+		replay(&rec[i], verbose, rec[0].tstamp, &fr);
+		if(rec[i].op == AJA_TraceWrite) writes++;
+		else reads++;
+		ctx[rec[i].ctx % 3]++;
+	}
+
+	printf("\n%u records", count);
+	if(count) printf(" over %.3f ms", (double)(rec[count - 1].tstamp - rec[0].tstamp) / 1000000.0);
+	printf("\n%llu reads, %llu writes (process %llu, softirq %llu, hard IRQ %llu)\n",
+		(unsigned long long)reads, (unsigned long long)writes,
+		(unsigned long long)ctx[AJA_TraceProcess], (unsigned long long)ctx[AJA_TraceSoftIRQ],
+		(unsigned long long)ctx[AJA_TraceHardIRQ]);
+
+	/* The accesses before the first IRQ and after the last one are not a full frame */
+	if(fr.frames > 1) {
+		uint64_t n = fr.frames - 1;
+		printf("%llu frames, accesses per frame: avg %.1f max %llu, hard IRQ avg %.1f max %llu\n",
+			(unsigned long long)n, (double)fr.total / n, (unsigned long long)fr.max,
+			(double)fr.irqtotal / n, (unsigned long long)fr.irqmax);
+	}
+
+	for(i = 0; i < REPLAY_REGS; i++) {
+		if(regs[i].reads + regs[i].writes) top[used++] = i;
+		mismatch += regs[i].mismatch;
+	}
+	qsort(top, used, sizeof(int), count_cmp);
+	printf("\nBusiest registers:\n");
+	for(i = 0; i < (uint32_t)used && i < REPLAY_TOP; i++) {
+		replay_reg_t *r = &regs[top[i]];
+		printf("  reg %4d  %10llu reads %10llu writes", top[i], (unsigned long long)r->reads, (unsigned long long)r->writes);
+		if(r->mismatch) printf("  %llu shadow mismatches", (unsigned long long)r->mismatch);
+		printf("\n");
+	}
+	printf("%llu shadow mismatches\n", (unsigned long long)mismatch);
+
+	if(dump) {
+		printf("\nRegister file:\n");
+		for(i = 0; i < REPLAY_REGS; i++) {
+			if(regs[i].known) printf("  reg %4u  0x%08X\n", i, regs[i].value);
+		}
+	}
+
+	free(rec);
+	return mismatch ? 2 : 0;
+}
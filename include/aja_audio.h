@@ -0,0 +1,366 @@
+/*******************************************************************************
+ * aja_audio.h
+ *
+ * Creation Date: October 19, 2026
+ * Author(s):
+ *
+ *
+ * Copyright (c) 2026, SpectSoft
+ *   All Rights Reserved.
+ *   http://www.spectsoft.com/
+ *   info@spectsoft.com
+ *
+ * $Id$
+ *
+ * DESC: Userspace audio conversion and varispeed resampling.  Card audio is
+ *       interleaved 32bit words holding 24bit samples in the top bits, in card
+ *       channel order (AJA_CaptureAudio slices, the AJACTL_AFEED ring).  The
+ *       conversions use AVX2 or SSE2 when the compiler targets them (-mavx2,
+ *       SSE2 is always there on x86_64) and plain C otherwise.  The plain C
+ *       versions (*_c) are always available for checking and benchmarks.
+ *       Link with -lm.
+ *
+ ******************************************************************************/
+#ifndef _AJA_AUDIO_H_
+#define _AJA_AUDIO_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define AJA_AUDIO_AVX2
+#endif
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define AJA_AUDIO_SSE2
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AJA_AUDIO_TOFLOAT 	(1.0f / 2147483648.0f)		/* Card word to [-1, 1) */
+#define AJA_AUDIO_TOINT 	8388608.0f			/* [-1, 1) to a 24bit sample */
+#define AJA_AUDIO_MAX 		(8388607.0f / 8388608.0f)	/* Largest 24bit sample */
+
+/****************************************************************************************/
+/* Plain C conversions                                                                  */
+
+static inline float aja_audio_s2f(int32_t v) {
+	return (float)v * AJA_AUDIO_TOFLOAT;
+}
+
+static inline int32_t aja_audio_f2s(float v) {
+	if(v < -1.0f) v = -1.0f;
+	if(v > AJA_AUDIO_MAX) v = AJA_AUDIO_MAX;
+	return (int32_t)((uint32_t)lrintf(v * AJA_AUDIO_TOINT) << 8);
+}
+
+static inline void aja_audio_tofloat_c(const int32_t *in, float *out, size_t n) {
+	size_t i;
+	for(i = 0; i < n; i++) out[i] = aja_audio_s2f(in[i]);
+	return;
+}
+
+static inline void aja_audio_toint_c(const float *in, int32_t *out, size_t n) {
+	size_t i;
+	for(i = 0; i < n; i++) out[i] = aja_audio_f2s(in[i]);
+	return;
+}
+
+/* Splits interleaved card audio into one float buffer per channel */
+static inline void aja_audio_deinterleave_c(const int32_t *in, float *const *out, int channels, size_t frames) {
+	size_t f;
+	int c;
+	for(f = 0; f < frames; f++) {
+		for(c = 0; c < channels; c++) out[c][f] = aja_audio_s2f(in[f * channels + c]);
+	}
+	return;
+}
+
+/* Joins one float buffer per channel into interleaved card audio */
+static inline void aja_audio_interleave_c(const float *const *in, int32_t *out, int channels, size_t frames) {
+	size_t f;
+	int c;
+	for(f = 0; f < frames; f++) {
+		for(c = 0; c < channels; c++) out[f * channels + c] = aja_audio_f2s(in[c][f]);
+	}
+	return;
+}
+
+/****************************************************************************************/
+/* Vector conversions, the same results as the plain C versions                         */
+
+static inline void aja_audio_tofloat(const int32_t *in, float *out, size_t n) {
+	size_t i = 0;
+#if defined(AJA_AUDIO_AVX2)
+	const __m256 scale8 = _mm256_set1_ps(AJA_AUDIO_TOFLOAT);
+	for(; i + 8 <= n; i += 8) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)(in + i));
+		_mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(v), scale8));
+	}
+#endif
+#if defined(AJA_AUDIO_SSE2)
+	const __m128 scale4 = _mm_set1_ps(AJA_AUDIO_TOFLOAT);
+	for(; i + 4 <= n; i += 4) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(in + i));
+		_mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(v), scale4));
+	}
+#endif
+	aja_audio_tofloat_c(in + i, out + i, n - i);
+	return;
+}
+
+static inline void aja_audio_toint(const float *in, int32_t *out, size_t n) {
+	size_t i = 0;
+#if defined(AJA_AUDIO_AVX2)
+	const __m256 lo8 = _mm256_set1_ps(-1.0f), hi8 = _mm256_set1_ps(AJA_AUDIO_MAX), scale8 = _mm256_set1_ps(AJA_AUDIO_TOINT);
+	for(; i + 8 <= n; i += 8) {
+		__m256 v = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(in + i), lo8), hi8);
+		_mm256_storeu_si256((__m256i *)(out + i), _mm256_slli_epi32(_mm256_cvtps_epi32(_mm256_mul_ps(v, scale8)), 8));
+	}
+#endif
+#if defined(AJA_AUDIO_SSE2)
+	const __m128 lo4 = _mm_set1_ps(-1.0f), hi4 = _mm_set1_ps(AJA_AUDIO_MAX), scale4 = _mm_set1_ps(AJA_AUDIO_TOINT);
+	for(; i + 4 <= n; i += 4) {
+		__m128 v = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + i), lo4), hi4);
+		_mm_storeu_si128((__m128i *)(out + i), _mm_slli_epi32(_mm_cvtps_epi32(_mm_mul_ps(v, scale4)), 8));
+	}
+#endif
+	aja_audio_toint_c(in + i, out + i, n - i);
+	return;
+}
+
+/* The (de)interleaves work on blocks of 4 frames by 4 channels, transposed in
+ * registers.  Channels past the last multiple of 4 are done one at a time. */
+static inline void aja_audio_deinterleave(const int32_t *in, float *const *out, int channels, size_t frames) {
+	size_t f = 0;
+	int c;
+#if defined(AJA_AUDIO_SSE2)
+	const __m128 scale = _mm_set1_ps(AJA_AUDIO_TOFLOAT);
+	int quads = channels & ~3;
+	for(; f + 4 <= frames; f += 4) {
+		const int32_t *p = in + f * channels;
+		for(c = 0; c < quads; c += 4) {
+			__m128 r0 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)(p + c))), scale);
+			__m128 r1 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)(p + channels + c))), scale);
+			__m128 r2 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)(p + 2 * channels + c))), scale);
+			__m128 r3 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)(p + 3 * channels + c))), scale);
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			_mm_storeu_ps(out[c] + f, r0);
+			_mm_storeu_ps(out[c + 1] + f, r1);
+			_mm_storeu_ps(out[c + 2] + f, r2);
+			_mm_storeu_ps(out[c + 3] + f, r3);
+		}
+		for(; c < channels; c++) {
+			out[c][f] = aja_audio_s2f(p[c]);
+			out[c][f + 1] = aja_audio_s2f(p[channels + c]);
+			out[c][f + 2] = aja_audio_s2f(p[2 * channels + c]);
+			out[c][f + 3] = aja_audio_s2f(p[3 * channels + c]);
+		}
+	}
+#endif
+	for(; f < frames; f++) {
+		for(c = 0; c < channels; c++) out[c][f] = aja_audio_s2f(in[f * channels + c]);
+	}
+	return;
+}
+
+static inline void aja_audio_interleave(const float *const *in, int32_t *out, int channels, size_t frames) {
+	size_t f = 0;
+	int c;
+#if defined(AJA_AUDIO_SSE2)
+	const __m128 lo = _mm_set1_ps(-1.0f), hi = _mm_set1_ps(AJA_AUDIO_MAX), scale = _mm_set1_ps(AJA_AUDIO_TOINT);
+	int quads = channels & ~3;
+	for(; f + 4 <= frames; f += 4) {
+		int32_t *p = out + f * channels;
+		for(c = 0; c < quads; c += 4) {
+			__m128 r0 = _mm_loadu_ps(in[c] + f);
+			__m128 r1 = _mm_loadu_ps(in[c + 1] + f);
+			__m128 r2 = _mm_loadu_ps(in[c + 2] + f);
+			__m128 r3 = _mm_loadu_ps(in[c + 3] + f);
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			r0 = _mm_mul_ps(_mm_min_ps(_mm_max_ps(r0, lo), hi), scale);
+			r1 = _mm_mul_ps(_mm_min_ps(_mm_max_ps(r1, lo), hi), scale);
+			r2 = _mm_mul_ps(_mm_min_ps(_mm_max_ps(r2, lo), hi), scale);
+			r3 = _mm_mul_ps(_mm_min_ps(_mm_max_ps(r3, lo), hi), scale);
+			_mm_storeu_si128((__m128i *)(p + c), _mm_slli_epi32(_mm_cvtps_epi32(r0), 8));
+			_mm_storeu_si128((__m128i *)(p + channels + c), _mm_slli_epi32(_mm_cvtps_epi32(r1), 8));
+			_mm_storeu_si128((__m128i *)(p + 2 * channels + c), _mm_slli_epi32(_mm_cvtps_epi32(r2), 8));
+			_mm_storeu_si128((__m128i *)(p + 3 * channels + c), _mm_slli_epi32(_mm_cvtps_epi32(r3), 8));
+		}
+		for(; c < channels; c++) {
+			p[c] = aja_audio_f2s(in[c][f]);
+			p[channels + c] = aja_audio_f2s(in[c][f + 1]);
+			p[2 * channels + c] = aja_audio_f2s(in[c][f + 2]);
+			p[3 * channels + c] = aja_audio_f2s(in[c][f + 3]);
+		}
+	}
+#endif
+	for(; f < frames; f++) {
+		for(c = 0; c < channels; c++) out[f * channels + c] = aja_audio_f2s(in[c][f]);
+	}
+	return;
+}
+
+/****************************************************************************************/
+/* Varispeed resampler                                                                  */
+
+/* A windowed sinc polyphase filter.  The output sample between two filter phases
+ * is blended from both, so any speed works, not just ratios of the phase count.
+ * 'speed' is the number of input frames used per output frame, normally the
+ * stream speed (aja_stream_getspeed).  Over a run of frames the average of
+ * meta.inc is the same speed, so the audio stays with the video. */
+#define AJA_RESAMPLE_TAPS 	32		/* Filter taps, a multiple of 8 */
+#define AJA_RESAMPLE_PHASES 	256		/* Filter phases per input frame */
+#define AJA_RESAMPLE_BLOCK 	8192		/* Input frames that can be queued */
+
+typedef struct {
+	int 		channels;	/* Number of channels */
+	double 		speed;		/* Input frames per output frame */
+	double 		pos;		/* Read position in the history */
+	int 		fill;		/* Frames in the history */
+	float 		*filter;	/* (PHASES + 1) x TAPS coefficients */
+	float 		**hist;		/* Input history for each channel, TAPS + BLOCK frames */
+} aja_resampler_t;
+
+static inline float aja_resample_dot_c(const float *a, const float *b) {
+	int i;
+	float sum = 0.0f;
+	for(i = 0; i < AJA_RESAMPLE_TAPS; i++) sum += a[i] * b[i];
+	return sum;
+}
+
+static inline float aja_resample_dot(const float *a, const float *b) {
+#if defined(AJA_AUDIO_AVX2)
+	int i = 0;
+	__m256 acc8 = _mm256_setzero_ps();
+	__m128 s;
+	for(; i < AJA_RESAMPLE_TAPS; i += 8) acc8 = _mm256_add_ps(acc8, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+	s = _mm_add_ps(_mm256_castps256_ps128(acc8), _mm256_extractf128_ps(acc8, 1));
+	s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+	s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+	return _mm_cvtss_f32(s);
+#elif defined(AJA_AUDIO_SSE2)
+	int i = 0;
+	__m128 acc4 = _mm_setzero_ps();
+	for(; i < AJA_RESAMPLE_TAPS; i += 4) acc4 = _mm_add_ps(acc4, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+	acc4 = _mm_add_ps(acc4, _mm_movehl_ps(acc4, acc4));
+	acc4 = _mm_add_ss(acc4, _mm_shuffle_ps(acc4, acc4, 1));
+	return _mm_cvtss_f32(acc4);
+#else
+	return aja_resample_dot_c(a, b);
+#endif
+}
+
+static inline void aja_resampler_free(aja_resampler_t *rs) {
+	int c;
+	if(rs->hist) {
+		for(c = 0; c < rs->channels; c++) free(rs->hist[c]);
+		free(rs->hist);
+	}
+	free(rs->filter);
+	rs->hist = NULL;
+	rs->filter = NULL;
+	return;
+}
+
+/* Sets up a resampler for speeds up to 'maxspeed'.  The filter cutoff drops with
+ * the top speed so fast play doesn't alias.  Returns 0 on success */
+static inline int aja_resampler_init(aja_resampler_t *rs, int channels, double maxspeed) {
+	const int half = AJA_RESAMPLE_TAPS / 2;
+	double fc = 0.46 / (maxspeed > 1.0 ? maxspeed : 1.0);
+	int p, k, c;
+
+	memset(rs, 0, sizeof(*rs));
+	rs->channels = channels;
+	rs->speed = 1.0;
+	rs->filter = (float *)malloc(sizeof(float) * (AJA_RESAMPLE_PHASES + 1) * AJA_RESAMPLE_TAPS);
+	rs->hist = (float **)calloc(channels, sizeof(float *));
+	if(rs->filter == NULL || rs->hist == NULL) goto init_fail;
+	for(c = 0; c < channels; c++) {
+		rs->hist[c] = (float *)calloc(AJA_RESAMPLE_TAPS + AJA_RESAMPLE_BLOCK, sizeof(float));
+		if(rs->hist[c] == NULL) goto init_fail;
+	}
+
+	// Phase p is for an output p / PHASES of a frame past tap half - 1
+	for(p = 0; p <= AJA_RESAMPLE_PHASES; p++) {
+		float *h = rs->filter + p * AJA_RESAMPLE_TAPS;
+		double sum = 0.0;
+		for(k = 0; k < AJA_RESAMPLE_TAPS; k++) {
+			double t = k - (half - 1) - (double)p / AJA_RESAMPLE_PHASES;
+			double x = 2.0 * M_PI * fc * t;
+			double w = 0.42 + 0.5 * cos(M_PI * t / half) + 0.08 * cos(2.0 * M_PI * t / half);	/* Blackman */
+			h[k] = (float)((x == 0.0 ? 1.0 : sin(x) / x) * (fabs(t) < half ? w : 0.0));
+			sum += h[k];
+		}
+		for(k = 0; k < AJA_RESAMPLE_TAPS; k++) h[k] = (float)(h[k] / sum);
+	}
+
+	// Start with a history of silence, so the first output is the filter delay in
+	rs->fill = AJA_RESAMPLE_TAPS - 1;
+	return 0;
+
+init_fail:
+	aja_resampler_free(rs);
+	return -1;
+}
+
+static inline void aja_resampler_setspeed(aja_resampler_t *rs, double speed) {
+	if(speed > 0.0) rs->speed = speed;
+	return;
+}
+
+/* Queues up to 'frames' frames of per-channel input.  Returns the frames taken */
+static inline int aja_resampler_push(aja_resampler_t *rs, const float *const *in, int frames) {
+	int c, space = AJA_RESAMPLE_TAPS + AJA_RESAMPLE_BLOCK - rs->fill;
+	if(frames > space) frames = space;
+	for(c = 0; c < rs->channels; c++) memcpy(rs->hist[c] + rs->fill, in[c], sizeof(float) * frames);
+	rs->fill += frames;
+	return frames;
+}
+
+/* Makes up to 'frames' frames of per-channel output.  Returns the frames made,
+ * fewer when it needs more input */
+static inline int aja_resampler_pull(aja_resampler_t *rs, float *const *out, int frames) {
+	int o, c, i, p;
+	double fr;
+	float w;
+
+	for(o = 0; o < frames; o++) {
+		const float *h0, *h1;
+		i = (int)rs->pos;
+		if(i + AJA_RESAMPLE_TAPS > rs->fill) break;
+		fr = (rs->pos - i) * AJA_RESAMPLE_PHASES;
+		p = (int)fr;
+		w = (float)(fr - p);
+		h0 = rs->filter + p * AJA_RESAMPLE_TAPS;
+		h1 = h0 + AJA_RESAMPLE_TAPS;
+		for(c = 0; c < rs->channels; c++) {
+			float a = aja_resample_dot(h0, rs->hist[c] + i);
+			float b = aja_resample_dot(h1, rs->hist[c] + i);
+			out[c][o] = a + w * (b - a);
+		}
+		rs->pos += rs->speed;
+	}
+
+	// Drop the history that has been passed
+	i = (int)rs->pos;
+	if(i > rs->fill) i = rs->fill;
+	if(i > 0) {
+		for(c = 0; c < rs->channels; c++) memmove(rs->hist[c], rs->hist[c] + i, sizeof(float) * (rs->fill - i));
+		rs->fill -= i;
+		rs->pos -= i;
+	}
+	return o;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ifndef _AJA_AUDIO_H_ */
+
@@ -30,7 +30,7 @@
 #include <pcitc.h>
 #include <timecode.h>
 
-#define AJA_API_VERSION 	202
+#define AJA_API_VERSION 	205
 
 /* AJA board IDs */
 #define AJA_KONASD11		0x10111900
@@ -64,8 +64,8 @@
 #define AJA_SD_ACAP		AJA_SD_APLAY + 0x100000
 #define AJA_HD_ACAP		AJA_HD_APLAY + 0x100000
 #define AJA_K2_ACAP		AJA_K2_APLAY + 0x100000
-#define AJA_APLAY_CARDSIZE 	3072 * 340
-#define AJA_ACAP_CARDSIZE 	3072 * 340
+#define AJA_APLAY_CARDSIZE 	(3072 * 340)
+#define AJA_ACAP_CARDSIZE 	(3072 * 340)
 
 #define AJA_SPEED_DIVISOR 	1000000
 
@@ -139,6 +139,25 @@ typedef struct {
 #define AJACTL_GETREGISTER		_IOR('y', 15, aja_registerio_t)
 #define AJACTL_SETREGISTER		_IOW('y', 16, aja_registerio_t)
 
+/* Vectored register I/O.  Writes are done first (in order), then any reads.  With
+ * AJA_RegNextFrame the writes are queued and all applied inside the next output
+ * vertical interrupt, so a reconfiguration can't straddle a frame. */
+#define AJA_MAXREGV 			64
+
+enum aja_registerv_flags {
+	AJA_RegRead 		= 0x01,		/* Read the registers into value */
+	AJA_RegWrite 		= 0x02,		/* Write value to the registers */
+	AJA_RegNextFrame 	= 0x04		/* Queue the writes for the next output vertical */
+};
+
+typedef struct {
+	int 			count;		/* Number of registers (up to AJA_MAXREGV) */
+	int 			flags;		/* aja_registerv_flags */
+	aja_registerio_t 	*regs;		/* Register list */
+} aja_registerv_t;
+
+#define AJACTL_REGISTERV 		_IOW('y', 17, aja_registerv_t)
+
 
 /****************************************************************************************/
 /* Interrupts                                                                           */
@@ -169,6 +188,17 @@ typedef struct {
 /* sleeps until an interrupt of a given type */
 #define AJACTL_IRQSLEEP 		_IO('y', 21)
 
+/* Output vertical IRQ handler timing, all times are in nanoseconds.  The hard IRQ
+ * half does the page flips, the threaded half does everything else. */
+typedef struct {
+	uint64_t 		count;		// Output IRQs measured
+	uint32_t 		last;		// Hard IRQ time of the last output IRQ
+	uint32_t 		max;		// Worst case hard IRQ time
+	uint32_t 		thread_last;	// Threaded half time of the last output IRQ
+	uint32_t 		thread_max;	// Worst case threaded half time
+	uint32_t 		latency_max;	// Worst case delay from hard IRQ to threaded half
+} aja_timing_t;
+
 /* Returns the timing of the last output IRQ event */
 #define AJACTL_IRQTIMING 		_IOR('y', 22, aja_timing_t)
 
@@ -185,8 +215,28 @@ typedef struct {
 	struct timeval 		tstamp;		// System timestamp
 	timecode_t 		tcg;		// Timecode generator timestamp
 	uint64_t 		priv;		// User specific private data
+	int64_t 		mono;		// CLOCK_MONOTONIC_RAW time of the IRQ, ns (CLOCK_MONOTONIC before 2.6.28)
 } aja_frametime_t;
 
+/* Card clock to system clock correlation.  Least squares fits against
+ * aja_frametime_t.mono, of the frame IDs over the last AJA_CLOCKSYNC_SAMPLES
+ * frames and of the 48KHz counter over AJA_CLOCKSYNC_SAMPLES samples taken every
+ * 16th frame.  Between the references:
+ *   mono(count) = count_mono + (count - this.count) * (1000000000 + drift) / 48000
+ *   mono(id) = id_mono + (id - this.id) * period / 65536 */
+#define AJA_CLOCKSYNC_SAMPLES 		32
+
+typedef struct {
+	int32_t 		samples;	// Frames in the fit, 0 if there is no estimate yet
+	int32_t 		drift;		// 48KHz counter error against the system clock, ppb (positive = card slow)
+	uint64_t 		count;		// Reference 48KHz count, extended to 64 bits
+	int64_t 		count_mono;	// Fitted system time of 'count', ns
+	int64_t 		id;		// Reference frame ID
+	int64_t 		id_mono;	// Fitted system time of frame 'id', ns
+	int64_t 		period;		// Frame period, 1/65536 ns
+	int64_t 		residual;	// Largest distance of a frame from the fit, ns
+} aja_clocksync_t;
+
 /* Get the current frame ID */
 #define AJACTL_FRAME_CURID 		_IOR('y', 30, int64_t)
 
@@ -196,6 +246,34 @@ typedef struct {
 /* Block until a new frame */
 #define AJACTL_FRAME_WAITFORNEXT 	_IO('y', 32)
 
+/* The frame clock page, mmap() offset AJA_MMAP_FRAMECLOCK pages, read only.  The
+ * driver updates it at the start of every frame.  'seq' is odd while an update is
+ * in progress, so read it, read the page, and retry if seq was odd or has changed
+ * (see aja_frameclock_read) */
+#define AJA_MMAP_FRAMECLOCK 		3
+
+typedef struct {
+	volatile uint32_t 	seq;		// Update sequence
+	int32_t 		fifo;		// Stream fifo level at the start of the frame
+	int32_t 		running;	// Stream running
+	uint32_t 		tcgflags;	// Timecode generator flags (aja_tcg_flags)
+	aja_frametime_t 	time;		// Current frame ID, timing and TCG timecode
+	aja_clocksync_t 	sync;		// Clock correlation as of this frame
+} aja_frameclock_t;
+
+typedef struct {
+	int64_t 		id;		// Wait for the frame with this ID (or any later frame)
+	int64_t 		deadline;	// Give up at this aja_frametime_t.mono time, ns, 0 = never
+	aja_frametime_t 	time;		// Returned: timing of the current frame
+} aja_frame_waituntil_t;
+
+/* Block until frame 'id' starts or the deadline passes (-ETIMEDOUT).  The caller
+ * is woken once, when the frame starts, no matter how far ahead 'id' is */
+#define AJACTL_FRAME_WAITUNTIL 		_IOWR('y', 33, aja_frame_waituntil_t)
+
+/* Get the current clock correlation */
+#define AJACTL_CLOCKSYNC 		_IOR('y', 34, aja_clocksync_t)
+
 
 /****************************************************************************************/
 /* DMA                                                                                  */
@@ -213,6 +291,8 @@ typedef struct {
 #define AJA_DMAFROMCARD 	1
 #define AJA_CAPTURE 		1
 
+/* The driver takes the first free engine.  Once an audio ring (AJA_CaptureAudio,
+ * the feeder or the ALSA PCM) is set up the third engine is left to it */
 #define AJACTL_DMA 			_IOWR('y', 40, aja_dmainfo_t)
 
 /****************************************************************************************/
@@ -261,12 +341,17 @@ enum aja_tcg_flags {
 enum aja_stream_flags {
 	AJA_Capture 		= 0x01,
 	AJA_Playback 		= 0x02,
-	AJA_TriggerAudio 	= 0x04
+	AJA_TriggerAudio 	= 0x04,
+	AJA_CaptureRing 	= 0x08,		/* Capture into a ring, overwriting the oldest frames until AJACTL_STREAM_RECORD */
+	AJA_CaptureAudio 	= 0x10		/* Transfer each captured frame's audio into the AJA_MMAP_AUDIO ring */
 };
 
 enum aja_stream_frame_flags {
 	AJA_ResetAudio 		= 0x01,
-	AJA_TimecodeBreak	= 0x02		/* Capture timecode was broken on this frame */
+	AJA_TimecodeBreak	= 0x02,		/* Capture timecode was broken on this frame */
+	AJA_AudioDropped 	= 0x04,		/* The frame's audio could not be transferred */
+	AJA_AVDrift 		= 0x08,		/* The audio drifted past the avdrift limit on this frame */
+	AJA_FrameDropped 	= 0x10		/* The capture ring recycled this frame before it was recorded */
 };
 
 typedef struct {
@@ -275,6 +360,9 @@ typedef struct {
 	int			inc;				/* Frame increment count */
 	int 			chan;				/* Frame channel number */
 	uint32_t 		audioptr;			/* Last audio buffer point */
+	uint32_t 		audiooffset;			/* Offset of the frame's audio in the AJA_MMAP_AUDIO ring */
+	uint32_t 		audiolen;			/* Bytes of audio captured during the frame (0 = none) */
+	int32_t 		avdrift;			/* Capture audio ahead of the video, us (see AJACTL_AVDRIFT) */
 	uint64_t 		priv;				/* User specific data */
 	timecode_t 		tc[AJA_TIMECODE_TYPES]; 	/* Timecode Data */
 } aja_stream_meta_t;
@@ -297,6 +385,37 @@ typedef struct {
 	timecode_t 		tc;		/* Timecode (from the TCG) of the dropped frame */
 } aja_stream_drop_t;
 
+/* Playlist for in-kernel loop playback.  Each entry is one frame, made up of
+ * 'chans' consecutive card pages in the pages array (pages[entry * chans + chan]).
+ * The engine plays entries in..out, then wraps back to 'in' until it has done
+ * 'loops' passes (0 loops forever).  A count of 0 clears the playlist.
+ * The playlist is cleared by AJACTL_STREAM_INIT, so load it afterwards.  Pages
+ * still queued on the fifo are refused with EBUSY. */
+typedef struct {
+	int 			count;			/* Number of entries (frames) in the list */
+	int 			in;			/* First entry of the loop */
+	int 			out;			/* Last entry of the loop */
+	int 			loops;			/* Number of passes to play (0 = forever) */
+	int 			pages[AJA_MAXPAGES];	/* Card pages in play order */
+} aja_stream_playlist_t;
+
+/* The captured audio ring of an AJA_CaptureAudio stream, mmap() offset
+ * AJA_MMAP_AUDIO pages, read only.  Every stream page has a slot of 'slotsize'
+ * bytes, and a captured frame's audio is at meta.audiooffset for meta.audiolen
+ * bytes, in whole sample frames of 'samplebytes'.  The slices follow the exact
+ * sample cadence of the frame rate (1601/1602 samples at 29.97).  The ring is
+ * reallocated by AJACTL_STREAM_INIT, so map it after the init.  Needs a kernel
+ * with threaded IRQs (2.6.30+), the init fails with EOPNOTSUPP before that. */
+#define AJA_MMAP_AUDIO 			4
+
+typedef struct {
+	uint32_t 		size;		/* Length of the ring (bytes) */
+	uint32_t 		slotsize;	/* Bytes per stream page */
+	uint32_t 		channels;	/* Audio channels */
+	uint32_t 		samplebytes;	/* Bytes per sample frame (all channels) */
+	uint32_t 		rate;		/* Sample rate */
+} aja_audioring_t;
+
 #define AJACTL_STREAM_RUNNING 		_IO('y', 60)				/* Returns true if engine is running */
 #define AJACTL_STREAM_DROPPED 		_IOR('y', 61, aja_stream_drop_t) 	/* Returns the number of dropped frames information structure */
 #define AJACTL_STREAM_INIT		_IOW('y', 62, aja_stream_init_t)	/* Initialize the stream */
@@ -312,6 +431,10 @@ typedef struct {
 #define AJACTL_STREAM_SETSPEED 		_IOW('y', 73, int)			/* Set the speed of the stream */
 #define AJACTL_STREAM_GETSPEED 		_IO('y', 74)				/* Get the speed of the stream */
 #define AJACTL_STREAM_SETTRIG 		_IOW('y', 75, int64_t)			/* Set stream trigger point */
+#define AJACTL_STREAM_PLAYLIST 		_IOW('y', 76, aja_stream_playlist_t)	/* Load (or clear) the playback playlist */
+#define AJACTL_STREAM_PLAYLIST_POS 	_IO('y', 77)				/* Current playlist entry, or -1 if not active */
+#define AJACTL_STREAM_RECORD 		_IOW('y', 78, int)			/* Commit the last N ring frames and everything after */
+#define AJACTL_STREAM_AUDIORING 	_IOR('y', 79, aja_audioring_t)		/* Get the layout of the captured audio ring */
 
 /****************************************************************************************/
 /* Audio                                                                                */
@@ -325,6 +448,42 @@ typedef struct {
 	int		frames;
 } aja_aframe_t;
 
+/* Audio playback feeder.  The driver keeps the card playback buffer topped up from
+ * a host ring that userspace maps at mmap() offset AJA_MMAP_AFEED pages.  The
+ * producer writes at offset (written % size) and then commits the bytes with
+ * AJACTL_AFEED_COMMIT, leaving at most 'size' bytes not yet read.  Each frame the
+ * driver tops the card up to 'target' bytes once it holds less than 'watermark'.
+ * With a playback stream, frames the video holds play a frame of silence and
+ * frames it bumps over skip their audio, so the audio follows the video.  If the
+ * host ring runs dry the card is padded with silence and an underrun is counted.
+ * Needs a kernel with threaded IRQs (2.6.30+), AJACTL_AFEED_INIT fails with
+ * EOPNOTSUPP before that. */
+#define AJA_MMAP_AFEED 			5
+
+typedef struct {
+	uint32_t 	size;		/* Host ring bytes, rounded up to whole pages */
+	uint32_t 	watermark;	/* Top the card up when it holds less than this (0 = 4 frames) */
+	uint32_t 	target;		/* Bytes to top the card up to (0 = twice the watermark) */
+} aja_afeed_init_t;
+
+typedef struct {
+	uint64_t 	written;	/* Bytes committed by the producer */
+	uint64_t 	read;		/* Bytes the driver has taken from the host ring */
+	uint64_t 	silence;	/* Bytes of silence played for underruns and held frames */
+	uint64_t 	skipped;	/* Bytes skipped for frames the video bumped over */
+	uint32_t 	size;		/* Host ring bytes */
+	uint32_t 	level;		/* Bytes queued on the card */
+	uint32_t 	underruns;	/* Number of times the card was padded with silence */
+	uint32_t 	samplebytes;	/* Bytes per sample frame (all channels) */
+	int32_t 	running;	/* The feeder is running */
+} aja_afeed_status_t;
+
+#define AJACTL_AFEED_INIT 		_IOWR('y', 85, aja_afeed_init_t)	/* Allocate the host ring */
+#define AJACTL_AFEED_START 		_IO('y', 86)				/* Prime the card, playback starts with AJACTL_APLAY_START or the stream */
+#define AJACTL_AFEED_STOP 		_IO('y', 87)				/* Stop feeding and playback */
+#define AJACTL_AFEED_COMMIT 		_IOW('y', 88, uint32_t)			/* Bytes written to the host ring */
+#define AJACTL_AFEED_STATUS 		_IOR('y', 89, aja_afeed_status_t)
+
 #define AJACTL_APLAY_START 		_IO('y', 91)
 #define AJACTL_APLAY_STOP 		_IO('y', 92)
 #define AJACTL_APLAY_POSITION 		_IOR('y', 93, aja_audio_position_t)
@@ -335,6 +494,58 @@ typedef struct {
 #define AJACTL_AFRAME_ADD		_IOW('y', 97, aja_aframe_t)
 #define AJACTL_AFRAME_GET		_IO('y', 98)
 
+/* Audio against video drift.  At every frame the driver compares the samples each
+ * card audio pointer moved with the samples the frame should have had, so the
+ * drift is measured from the start of the audio rather than found after a long
+ * recording.  Drift is the change since the pointer was anchored (the first frame
+ * it moved), positive when the audio runs ahead.  A pointer that jumps (audio reset)
+ * is anchored again.  Crossing the avdrift module parameter limit counts an event
+ * and flags the captured frame with AJA_AVDrift.  Cleared when a stream starts. */
+typedef struct {
+	int64_t 	event_id;	/* Frame ID of the last limit crossing */
+	uint32_t 	frames;		/* Frames the capture pointer has been followed, 0 = not moving */
+	uint32_t 	play_frames;	/* Frames the playback pointer has been followed */
+	int32_t 	capture;	/* Capture audio ahead of the video, us */
+	int32_t 	playback;	/* Playback audio ahead of the video, us */
+	int32_t 	capture_rate;	/* Capture drift over the run, ppb */
+	int32_t 	playback_rate;	/* Playback drift over the run, ppb */
+	int32_t 	skew;		/* Capture pointer ahead of the end of the last frame's slice, samples (AJA_CaptureAudio) */
+	int32_t 	worst;		/* Largest drift seen, us */
+	int32_t 	limit;		/* Event limit, us (0 = off) */
+	uint32_t 	events;		/* Times the drift crossed the limit */
+	uint32_t 	resets;		/* Times a pointer jumped and was anchored again */
+} aja_avdrift_t;
+
+#define AJACTL_AVDRIFT 			_IOR('y', 99, aja_avdrift_t)
+
+/****************************************************************************************/
+/* Serial port                                                                          */
+
+/* RS-422 (Sony 9-pin) slave port statistics.  Times are CLOCK_MONOTONIC_RAW ns, the
+ * same clock as aja_frametime_t.mono.  A command's bytes are stamped as the UART IRQ
+ * drains them and the reply's as they go into the transmit FIFO, so 'latency' is the
+ * time the driver took to answer the last command. */
+typedef struct {
+	uint64_t 	packets;	/* Commands answered */
+	uint64_t 	rxbytes;	/* Bytes received */
+	uint64_t 	txbytes;	/* Bytes transmitted */
+	uint64_t 	statusreads;	/* UART status reads, one per byte or TX burst */
+	int64_t 	rx_first;	/* Last command's first byte */
+	int64_t 	rx_last;	/* Last command's last byte */
+	int64_t 	tx_first;	/* Its reply's first byte */
+	int64_t 	tx_last;	/* Its reply's last byte */
+	uint32_t 	latency;	/* rx_last to tx_first */
+	uint32_t 	latency_max;	/* Worst latency */
+	uint32_t 	rxtime_max;	/* Longest command, first to last byte */
+	uint32_t 	parity;		/* Parity errors */
+	uint32_t 	overruns;	/* Receive FIFO overruns */
+	uint32_t 	timeouts;	/* Commands abandoned after uart_timeout without a byte */
+	uint32_t 	fifo;		/* Bytes written per TX burst (uart_fifo module parameter) */
+	uint32_t 	timeout;	/* Inter-byte timeout, us (uart_timeout module parameter) */
+} aja_uartstats_t;
+
+#define AJACTL_UART_STATS 		_IOR('y', 105, aja_uartstats_t)
+
 /****************************************************************************************/
 /* Benchmarks                                                                           */
 
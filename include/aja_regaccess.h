@@ -0,0 +1,2060 @@
+/* AJA CARD REGISTER ACCESSORS 
+ * THIS FILE IS AUTOMATICALY GENERATED BY THE SPECTSOFT AJA-DRIVER PACKAGE */
+
+
+#ifndef _AJA_REGACCESS_H_
+#define _AJA_REGACCESS_H_
+
+
+#ifndef __KERNEL__
+#include <stdint.h>
+#endif
+
+/* The includer may define the register context and the access macros.  The default
+ * is a userspace pointer to the mmap'ed register space (BAR0), which is read only:
+ * userspace writes go through the driver so its shadow registers stay right */
+#ifndef AJA_REGCTX
+#define AJA_REGCTX const volatile uint32_t *
+#define AJA_REGREAD(c, add) ((c)[(add) / 4])
+#endif
+
+/* 1080p50/60 dual link output enable (Reg 0, bits 15 to 15) */
+static inline uint32_t ajareg_get_1080pdual(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x0u) & 0x00008000u) >> 15; }
+#define ajareg_get_1080pdual_small ajareg_get_1080pdual
+
+/* Audio Capture Enable (Reg 24, bits 0 to 0) */
+static inline uint32_t ajareg_get_acapenable(AJA_REGCTX c) { return AJA_REGREAD(c, 0x60u) & 0x00000001u; }
+#define ajareg_get_acapenable_small ajareg_get_acapenable
+
+/* Audio Capture Last Address (Reg 27, bits 0 to 19) */
+static inline uint32_t ajareg_get_acaplast(AJA_REGCTX c) { return AJA_REGREAD(c, 0x6Cu) & 0x000FFFFFu; }
+#define ajareg_get_acaplast_small ajareg_get_acaplast
+
+/* Audio Capture Reset (Reg 24, bits 8 to 8) */
+static inline uint32_t ajareg_get_acapreset(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00000100u) >> 8; }
+#define ajareg_get_acapreset_small ajareg_get_acapreset
+
+/* Audio Capture Wrap IRQ Active (depreciated) (Reg 21, bits 26 to 26) */
+static inline uint32_t ajareg_get_acapwrapirq(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x54u) & 0x04000000u) >> 26; }
+#define ajareg_get_acapwrapirq_small ajareg_get_acapwrapirq
+
+/* Audio Capture Wrap IRQ Enable (depreciated) (Reg 20, bits 5 to 5) */
+static inline uint32_t ajareg_get_acapwrapirqenable(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x50u) & 0x00000020u) >> 5; }
+#define ajareg_get_acapwrapirqenable_small ajareg_get_acapwrapirqenable
+
+/* AES 1/2 Invalid Data (Reg 22, bits 24 to 24) */
+static inline uint32_t ajareg_get_aes12invalid(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x01000000u) >> 24; }
+#define ajareg_get_aes12invalid_small ajareg_get_aes12invalid
+
+/* AES 3/4 Invalid Data (Reg 22, bits 25 to 25) */
+static inline uint32_t ajareg_get_aes34invalid(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x02000000u) >> 25; }
+#define ajareg_get_aes34invalid_small ajareg_get_aes34invalid
+
+/* AES 5/6 Invalid Data (Reg 22, bits 26 to 26) */
+static inline uint32_t ajareg_get_aes56invalid(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x04000000u) >> 26; }
+#define ajareg_get_aes56invalid_small ajareg_get_aes56invalid
+
+/* AES 7/8 Invalid Data (Reg 22, bits 27 to 27) */
+static inline uint32_t ajareg_get_aes78invalid(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x08000000u) >> 27; }
+#define ajareg_get_aes78invalid_small ajareg_get_aes78invalid
+
+/* AES/EBU Supported (Reg 24, bits 21 to 21) */
+static inline uint32_t ajareg_get_aessup(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00200000u) >> 21; }
+#define ajareg_get_aessup_small ajareg_get_aessup
+
+/* Audio Buffer 1/2 Select (Reg 25, bits 0 to 3) */
+static inline uint32_t ajareg_get_ain12select(AJA_REGCTX c) { return AJA_REGREAD(c, 0x64u) & 0x0000000Fu; }
+#define ajareg_get_ain12select_small ajareg_get_ain12select
+
+/* Audio Buffer 3/4 Select (Reg 25, bits 4 to 7) */
+static inline uint32_t ajareg_get_ain34select(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x64u) & 0x000000F0u) >> 4; }
+#define ajareg_get_ain34select_small ajareg_get_ain34select
+
+/* Audio Buffer 5/6 Select (Reg 25, bits 8 to 11) */
+static inline uint32_t ajareg_get_ain56select(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x64u) & 0x00000F00u) >> 8; }
+#define ajareg_get_ain56select_small ajareg_get_ain56select
+
+/* Audio Buffer 7/8 Select (Reg 25, bits 12 to 15) */
+static inline uint32_t ajareg_get_ain78select(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x64u) & 0x0000F000u) >> 12; }
+#define ajareg_get_ain78select_small ajareg_get_ain78select
+
+/* Audio Mute Ch 1/2 (Reg 24, bits 4 to 4) */
+static inline uint32_t ajareg_get_amute12(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00000010u) >> 4; }
+#define ajareg_get_amute12_small ajareg_get_amute12
+
+/* Audio Mute Ch 3/4 (Reg 24, bits 5 to 5) */
+static inline uint32_t ajareg_get_amute34(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00000020u) >> 5; }
+#define ajareg_get_amute34_small ajareg_get_amute34
+
+/* Audio Mute Ch 5/6 (Reg 24, bits 6 to 6) */
+static inline uint32_t ajareg_get_amute56(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00000040u) >> 6; }
+#define ajareg_get_amute56_small ajareg_get_amute56
+
+/* Audio Mute Ch 7/8 (Reg 24, bits 17 to 17) */
+static inline uint32_t ajareg_get_amute78(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00020000u) >> 17; }
+#define ajareg_get_amute78_small ajareg_get_amute78
+
+/* Analog Out - DAC Mode (Reg 128, bits 0 to 4) */
+static inline uint32_t ajareg_get_aoutdac(AJA_REGCTX c) { return AJA_REGREAD(c, 0x200u) & 0x0000001Fu; }
+static inline uint32_t ajareg_get_aoutdac_small(AJA_REGCTX c) { return 0; }
+
+/* Analog Out Crosspoint (Reg 138, bits 0 to 7) */
+static inline uint32_t ajareg_get_aoutxpt(AJA_REGCTX c) { return AJA_REGREAD(c, 0x228u) & 0x000000FFu; }
+static inline uint32_t ajareg_get_aoutxpt_small(AJA_REGCTX c) { return 0; }
+
+/* Audio Playback Last Address (Reg 26, bits 0 to 19) */
+static inline uint32_t ajareg_get_aplaylast(AJA_REGCTX c) { return AJA_REGREAD(c, 0x68u) & 0x000FFFFFu; }
+#define ajareg_get_aplaylast_small ajareg_get_aplaylast
+
+/* Audio Playback Pause (Reg 24, bits 11 to 11) */
+static inline uint32_t ajareg_get_aplaypause(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00000800u) >> 11; }
+#define ajareg_get_aplaypause_small ajareg_get_aplaypause
+
+/* Audio Playback Reset (Reg 24, bits 9 to 9) */
+static inline uint32_t ajareg_get_aplayreset(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00000200u) >> 9; }
+#define ajareg_get_aplayreset_small ajareg_get_aplayreset
+
+/* Audio 20bit Output (Reg 24, bits 2 to 2) */
+static inline uint32_t ajareg_get_aplaysize(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00000004u) >> 2; }
+#define ajareg_get_aplaysize_small ajareg_get_aplaysize
+
+/* Audio Playback Wrap IRQ Active (depreciated) (Reg 21, bits 27 to 27) */
+static inline uint32_t ajareg_get_aplaywrapirq(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x54u) & 0x08000000u) >> 27; }
+#define ajareg_get_aplaywrapirq_small ajareg_get_aplaywrapirq
+
+/* Audio Playback Wrap IRQ Enable (depreciated) (Reg 20, bits 4 to 4) */
+static inline uint32_t ajareg_get_aplaywrapirqenable(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x50u) & 0x00000010u) >> 4; }
+#define ajareg_get_aplaywrapirqenable_small ajareg_get_aplaywrapirqenable
+
+/* Audio Tone Output Enable (Reg 24, bits 1 to 1) */
+static inline uint32_t ajareg_get_atoneoutput(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00000002u) >> 1; }
+#define ajareg_get_atoneoutput_small ajareg_get_atoneoutput
+
+/* Enable 16 channels of audio (Reg 24, bits 20 to 20) */
+static inline uint32_t ajareg_get_audio16chan(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00100000u) >> 20; }
+#define ajareg_get_audio16chan_small ajareg_get_audio16chan
+
+/* Enable 8 channels of audio (Reg 24, bits 16 to 16) */
+static inline uint32_t ajareg_get_audio8chan(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00010000u) >> 16; }
+#define ajareg_get_audio8chan_small ajareg_get_audio8chan
+
+/* 8 Channel Audio Supported (Reg 24, bits 23 to 23) */
+static inline uint32_t ajareg_get_audio8chansup(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00800000u) >> 23; }
+#define ajareg_get_audio8chansup_small ajareg_get_audio8chansup
+
+/* Enable 96KHz audio sample rate (Reg 24, bits 18 to 18) */
+static inline uint32_t ajareg_get_audio96khz(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00040000u) >> 18; }
+#define ajareg_get_audio96khz_small ajareg_get_audio96khz
+
+/* Audio Buffer Size (Reg 24, bits 30 to 31) */
+static inline uint32_t ajareg_get_audiobigbuffer(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0xC0000000u) >> 30; }
+#define ajareg_get_audiobigbuffer_small ajareg_get_audiobigbuffer
+
+/* Audio Cable Type (Reg 24, bits 27 to 28) */
+static inline uint32_t ajareg_get_audiocable(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x18000000u) >> 27; }
+#define ajareg_get_audiocable_small ajareg_get_audiocable
+
+/* 48KHz Audio Counter (Reg 28, bits 0 to 31) */
+static inline uint32_t ajareg_get_audiocount(AJA_REGCTX c) { return AJA_REGREAD(c, 0x70u); }
+#define ajareg_get_audiocount_small ajareg_get_audiocount
+
+/* Audio 50Hz IRQ Active (depreciated) (Reg 21, bits 28 to 28) */
+static inline uint32_t ajareg_get_audioirq(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x54u) & 0x10000000u) >> 28; }
+#define ajareg_get_audioirq_small ajareg_get_audioirq
+
+/* Audio 50Hz IRQ Enable (depreciated) (Reg 20, bits 3 to 3) */
+static inline uint32_t ajareg_get_audioirqenable(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x50u) & 0x00000008u) >> 3; }
+#define ajareg_get_audioirqenable_small ajareg_get_audioirqenable
+
+/* Audio Loopback Enable (Reg 24, bits 3 to 3) */
+static inline uint32_t ajareg_get_audioloopback(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00000008u) >> 3; }
+#define ajareg_get_audioloopback_small ajareg_get_audioloopback
+
+/* Enable raw AES/EBU recording from ch1&2 (Reg 24, bits 19 to 19) */
+static inline uint32_t ajareg_get_audioraw(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00080000u) >> 19; }
+#define ajareg_get_audioraw_small ajareg_get_audioraw
+
+/* Audio Wrap IRQ Active (Reg 21, bits 25 to 25) */
+static inline uint32_t ajareg_get_audiowrapirq(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x54u) & 0x02000000u) >> 25; }
+#define ajareg_get_audiowrapirq_small ajareg_get_audiowrapirq
+
+/* Audio Wrap IRQ Enable (Reg 20, bits 6 to 6) */
+static inline uint32_t ajareg_get_audiowrapirqenable(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x50u) & 0x00000040u) >> 6; }
+#define ajareg_get_audiowrapirqenable_small ajareg_get_audiowrapirqenable
+
+/* Board ID (Reg 50, bits 0 to 31) */
+static inline uint32_t ajareg_get_boardid(AJA_REGCTX c) { return AJA_REGREAD(c, 0xC8u); }
+#define ajareg_get_boardid_small ajareg_get_boardid
+
+/* Board Version Number (Reg 21, bits 0 to 3) */
+static inline uint32_t ajareg_get_boardversion(AJA_REGCTX c) { return AJA_REGREAD(c, 0x54u) & 0x0000000Fu; }
+#define ajareg_get_boardversion_small ajareg_get_boardversion
+
+/* Bus Error IRQ Active (Reg 48, bits 31 to 31) */
+static inline uint32_t ajareg_get_buserrorirq(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC0u) & 0x80000000u) >> 31; }
+#define ajareg_get_buserrorirq_small ajareg_get_buserrorirq
+
+/* Bus Error IRQ Enable (Reg 49, bits 4 to 4) */
+static inline uint32_t ajareg_get_buserrorirqenable(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC4u) & 0x00000010u) >> 4; }
+#define ajareg_get_buserrorirqenable_small ajareg_get_buserrorirqenable
+
+/* Chan 1 Alpha from Input 2 (Reg 1, bits 5 to 5) */
+static inline uint32_t ajareg_get_ch1alphainput2(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x4u) & 0x00000020u) >> 5; }
+#define ajareg_get_ch1alphainput2_small ajareg_get_ch1alphainput2
+
+/* Chan 1 Dither Input (Reg 1, bits 16 to 16) */
+static inline uint32_t ajareg_get_ch1dither(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x4u) & 0x00010000u) >> 16; }
+#define ajareg_get_ch1dither_small ajareg_get_ch1dither
+
+/* DRT Display? (Reg 1, bits 11 to 11) */
+static inline uint32_t ajareg_get_ch1drtdisplay(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x4u) & 0x00000800u) >> 11; }
+#define ajareg_get_ch1drtdisplay_small ajareg_get_ch1drtdisplay
+
+/* Chan 1 extended format (Reg 1, bits 6 to 6) */
+static inline uint32_t ajareg_get_ch1extformat(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x4u) & 0x00000040u) >> 6; }
+#define ajareg_get_ch1extformat_small ajareg_get_ch1extformat
+
+/* Chan 1 Flip Vertical (Reg 1, bits 10 to 10) */
+static inline uint32_t ajareg_get_ch1flipvert(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x4u) & 0x00000400u) >> 10; }
+#define ajareg_get_ch1flipvert_small ajareg_get_ch1flipvert
+
+/* Chan 1 Format (Reg 1, bits 1 to 4) */
+static inline uint32_t ajareg_get_ch1format(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x4u) & 0x0000001Eu) >> 1; }
+#define ajareg_get_ch1format_small ajareg_get_ch1format
+
+/* Chan 1 Frame Size (Reg 1, bits 21 to 22) */
+static inline uint32_t ajareg_get_ch1framesize(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x4u) & 0x00600000u) >> 21; }
+#define ajareg_get_ch1framesize_small ajareg_get_ch1framesize
+
+/* Chan 1 Input Frame (Reg 4, bits 0 to 31) */
+static inline uint32_t ajareg_get_ch1input(AJA_REGCTX c) { return AJA_REGREAD(c, 0x10u); }
+#define ajareg_get_ch1input_small ajareg_get_ch1input
+
+/* Chan 1 LUT Control (Reg 68, bits 0 to 31) */
+static inline uint32_t ajareg_get_ch1lutcont(AJA_REGCTX c) { return AJA_REGREAD(c, 0x110u); }
+static inline uint32_t ajareg_get_ch1lutcont_small(AJA_REGCTX c) { return 0; }
+
+/* Chan 1 Mode (Reg 1, bits 0 to 0) */
+static inline uint32_t ajareg_get_ch1mode(AJA_REGCTX c) { return AJA_REGREAD(c, 0x4u) & 0x00000001u; }
+#define ajareg_get_ch1mode_small ajareg_get_ch1mode
+
+/* Chan 1 Output Frame (Reg 3, bits 0 to 31) */
+static inline uint32_t ajareg_get_ch1output(AJA_REGCTX c) { return AJA_REGREAD(c, 0xCu); }
+#define ajareg_get_ch1output_small ajareg_get_ch1output
+
+/* Chan 1 PCI Frame (Reg 2, bits 0 to 31) */
+static inline uint32_t ajareg_get_ch1pciframe(AJA_REGCTX c) { return AJA_REGREAD(c, 0x8u); }
+#define ajareg_get_ch1pciframe_small ajareg_get_ch1pciframe
+
+/* RGB Range (Reg 1, bits 24 to 24) */
+static inline uint32_t ajareg_get_ch1rgbrange(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x4u) & 0x01000000u) >> 24; }
+#define ajareg_get_ch1rgbrange_small ajareg_get_ch1rgbrange
+
+/* Chan 1 RP188 Bits 0-31 (Reg 30, bits 0 to 31) */
+static inline uint32_t ajareg_get_ch1rp188_1(AJA_REGCTX c) { return AJA_REGREAD(c, 0x78u); }
+#define ajareg_get_ch1rp188_1_small ajareg_get_ch1rp188_1
+
+/* Chan 1 RP188 Bits 32-63 (Reg 31, bits 0 to 31) */
+static inline uint32_t ajareg_get_ch1rp188_2(AJA_REGCTX c) { return AJA_REGREAD(c, 0x7Cu); }
+#define ajareg_get_ch1rp188_2_small ajareg_get_ch1rp188_2
+
+/* Chan 1 RP188 DBB (Reg 29, bits 0 to 31) */
+static inline uint32_t ajareg_get_ch1rp188dbb(AJA_REGCTX c) { return AJA_REGREAD(c, 0x74u); }
+#define ajareg_get_ch1rp188dbb_small ajareg_get_ch1rp188dbb
+
+/* Chan 1 RP188 DBB 1 (Reg 29, bits 0 to 7) */
+static inline uint32_t ajareg_get_ch1rp188dbb1(AJA_REGCTX c) { return AJA_REGREAD(c, 0x74u) & 0x000000FFu; }
+#define ajareg_get_ch1rp188dbb1_small ajareg_get_ch1rp188dbb1
+
+/* Chan 1 RP188 DBB 2 (Reg 29, bits 8 to 15) */
+static inline uint32_t ajareg_get_ch1rp188dbb2(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x74u) & 0x0000FF00u) >> 8; }
+#define ajareg_get_ch1rp188dbb2_small ajareg_get_ch1rp188dbb2
+
+/* Chan 1 RP188 filter (Reg 29, bits 24 to 31) */
+static inline uint32_t ajareg_get_ch1rp188filter(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x74u) & 0xFF000000u) >> 24; }
+#define ajareg_get_ch1rp188filter_small ajareg_get_ch1rp188filter
+
+/* Chan 1 RP-188 Output (Reg 0, bits 28 to 28) */
+static inline uint32_t ajareg_get_ch1rp188out(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x0u) & 0x10000000u) >> 28; }
+#define ajareg_get_ch1rp188out_small ajareg_get_ch1rp188out
+
+/* Chan 1 RP188 recieved (Reg 29, bits 16 to 16) */
+static inline uint32_t ajareg_get_ch1rp188recv(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x74u) & 0x00010000u) >> 16; }
+#define ajareg_get_ch1rp188recv_small ajareg_get_ch1rp188recv
+
+/* Chan 1 RP188 recieved valid (Reg 29, bits 17 to 17) */
+static inline uint32_t ajareg_get_ch1rp188valid(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x74u) & 0x00020000u) >> 17; }
+#define ajareg_get_ch1rp188valid_small ajareg_get_ch1rp188valid
+
+/* Chan 1 Single Field (Reg 1, bits 12 to 12) */
+static inline uint32_t ajareg_get_ch1sfield(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x4u) & 0x00001000u) >> 12; }
+#define ajareg_get_ch1sfield_small ajareg_get_ch1sfield
+
+/* Chan 1 Horizontal Squeeze (Reg 1, bits 9 to 9) */
+static inline uint32_t ajareg_get_ch1squeeze(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x4u) & 0x00000200u) >> 9; }
+#define ajareg_get_ch1squeeze_small ajareg_get_ch1squeeze
+
+/* Chan 1 Writeback (Reg 1, bits 8 to 8) */
+static inline uint32_t ajareg_get_ch1writeback(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x4u) & 0x00000100u) >> 8; }
+#define ajareg_get_ch1writeback_small ajareg_get_ch1writeback
+
+/* Chan 2 Disable (Reg 5, bits 7 to 7) */
+static inline uint32_t ajareg_get_ch2disable(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x14u) & 0x00000080u) >> 7; }
+#define ajareg_get_ch2disable_small ajareg_get_ch2disable
+
+/* Chan 2 Dither Input (Reg 5, bits 16 to 16) */
+static inline uint32_t ajareg_get_ch2dither(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x14u) & 0x00010000u) >> 16; }
+#define ajareg_get_ch2dither_small ajareg_get_ch2dither
+
+/* Chan 2 Flip Vertical (Reg 5, bits 10 to 10) */
+static inline uint32_t ajareg_get_ch2flipvert(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x14u) & 0x00000400u) >> 10; }
+#define ajareg_get_ch2flipvert_small ajareg_get_ch2flipvert
+
+/* Chan 2 Format (Reg 5, bits 1 to 4) */
+static inline uint32_t ajareg_get_ch2format(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x14u) & 0x0000001Eu) >> 1; }
+#define ajareg_get_ch2format_small ajareg_get_ch2format
+
+/* Chan 2 Input Frame (Reg 8, bits 0 to 31) */
+static inline uint32_t ajareg_get_ch2input(AJA_REGCTX c) { return AJA_REGREAD(c, 0x20u); }
+#define ajareg_get_ch2input_small ajareg_get_ch2input
+
+/* Chan 2 Mode (Reg 5, bits 0 to 0) */
+static inline uint32_t ajareg_get_ch2mode(AJA_REGCTX c) { return AJA_REGREAD(c, 0x14u) & 0x00000001u; }
+#define ajareg_get_ch2mode_small ajareg_get_ch2mode
+
+/* Chan 2 Output Frame (Reg 7, bits 0 to 31) */
+static inline uint32_t ajareg_get_ch2output(AJA_REGCTX c) { return AJA_REGREAD(c, 0x1Cu); }
+#define ajareg_get_ch2output_small ajareg_get_ch2output
+
+/* Chan 2 PCI Frame (Reg 6, bits 0 to 31) */
+static inline uint32_t ajareg_get_ch2pciframe(AJA_REGCTX c) { return AJA_REGREAD(c, 0x18u); }
+#define ajareg_get_ch2pciframe_small ajareg_get_ch2pciframe
+
+/* Input/Output 2 RP188 low (Reg 65, bits 0 to 31) */
+static inline uint32_t ajareg_get_ch2rp188_1(AJA_REGCTX c) { return AJA_REGREAD(c, 0x104u); }
+static inline uint32_t ajareg_get_ch2rp188_1_small(AJA_REGCTX c) { return 0; }
+
+/* Input/Output 2 RP188 high (Reg 66, bits 0 to 31) */
+static inline uint32_t ajareg_get_ch2rp188_2(AJA_REGCTX c) { return AJA_REGREAD(c, 0x108u); }
+static inline uint32_t ajareg_get_ch2rp188_2_small(AJA_REGCTX c) { return 0; }
+
+/* Input/Output 2 RP188 DBB (Reg 64, bits 0 to 31) */
+static inline uint32_t ajareg_get_ch2rp188dbb(AJA_REGCTX c) { return AJA_REGREAD(c, 0x100u); }
+static inline uint32_t ajareg_get_ch2rp188dbb_small(AJA_REGCTX c) { return 0; }
+
+/* Channel 2 RP188 filter (Reg 64, bits 24 to 31) */
+static inline uint32_t ajareg_get_ch2rp188filter(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x100u) & 0xFF000000u) >> 24; }
+static inline uint32_t ajareg_get_ch2rp188filter_small(AJA_REGCTX c) { return 0; }
+
+/* Chan 2 RP-188 Output (Reg 0, bits 29 to 29) */
+static inline uint32_t ajareg_get_ch2rp188out(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x0u) & 0x20000000u) >> 29; }
+#define ajareg_get_ch2rp188out_small ajareg_get_ch2rp188out
+
+/* Input 2 RP188 Valid (Reg 64, bits 17 to 17) */
+static inline uint32_t ajareg_get_ch2rp188valid(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x100u) & 0x00020000u) >> 17; }
+static inline uint32_t ajareg_get_ch2rp188valid_small(AJA_REGCTX c) { return 0; }
+
+/* Chan 2 Single Field (Reg 5, bits 12 to 12) */
+static inline uint32_t ajareg_get_ch2sfield(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x14u) & 0x00001000u) >> 12; }
+#define ajareg_get_ch2sfield_small ajareg_get_ch2sfield
+
+/* Chan 2 Viper Squeeze (Reg 5, bits 9 to 9) */
+static inline uint32_t ajareg_get_ch2viper(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x14u) & 0x00000200u) >> 9; }
+#define ajareg_get_ch2viper_small ajareg_get_ch2viper
+
+/* Channel 1 Crosspoint (Reg 137, bits 0 to 7) */
+static inline uint32_t ajareg_get_chan1xpt(AJA_REGCTX c) { return AJA_REGREAD(c, 0x224u) & 0x000000FFu; }
+static inline uint32_t ajareg_get_chan1xpt_small(AJA_REGCTX c) { return 0; }
+
+/* FrameBuffer 2 Crosspoint (Reg 140, bits 0 to 7) */
+static inline uint32_t ajareg_get_chan2xpt(AJA_REGCTX c) { return AJA_REGREAD(c, 0x230u) & 0x000000FFu; }
+static inline uint32_t ajareg_get_chan2xpt_small(AJA_REGCTX c) { return 0; }
+
+/* Color Correction Bank Select (Reg 0, bits 30 to 31) */
+static inline uint32_t ajareg_get_clutbank(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x0u) & 0xC0000000u) >> 30; }
+#define ajareg_get_clutbank_small ajareg_get_clutbank
+
+/* Compressor Crosspoint (Reg 136, bits 24 to 31) */
+static inline uint32_t ajareg_get_compressxpt(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x220u) & 0xFF000000u) >> 24; }
+static inline uint32_t ajareg_get_compressxpt_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 make alpha from key (Reg 142, bits 29 to 29) */
+static inline uint32_t ajareg_get_csconv1alphafromkey(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x238u) & 0x20000000u) >> 29; }
+static inline uint32_t ajareg_get_csconv1alphafromkey_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 Custom Coefficient 0 (Reg 142, bits 0 to 10) */
+static inline uint32_t ajareg_get_csconv1coef0(AJA_REGCTX c) { return AJA_REGREAD(c, 0x238u) & 0x000007FFu; }
+static inline uint32_t ajareg_get_csconv1coef0_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 Custom Coefficient 1 (Reg 142, bits 16 to 26) */
+static inline uint32_t ajareg_get_csconv1coef1(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x238u) & 0x07FF0000u) >> 16; }
+static inline uint32_t ajareg_get_csconv1coef1_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 Custom Coefficient 2 (Reg 143, bits 0 to 10) */
+static inline uint32_t ajareg_get_csconv1coef2(AJA_REGCTX c) { return AJA_REGREAD(c, 0x23Cu) & 0x000007FFu; }
+static inline uint32_t ajareg_get_csconv1coef2_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 Custom Coefficient 3 (Reg 143, bits 16 to 26) */
+static inline uint32_t ajareg_get_csconv1coef3(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x23Cu) & 0x07FF0000u) >> 16; }
+static inline uint32_t ajareg_get_csconv1coef3_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 Custom Coefficient 4 (Reg 144, bits 0 to 10) */
+static inline uint32_t ajareg_get_csconv1coef4(AJA_REGCTX c) { return AJA_REGREAD(c, 0x240u) & 0x000007FFu; }
+static inline uint32_t ajareg_get_csconv1coef4_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 Custom Coefficient 5 (Reg 144, bits 16 to 26) */
+static inline uint32_t ajareg_get_csconv1coef5(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x240u) & 0x07FF0000u) >> 16; }
+static inline uint32_t ajareg_get_csconv1coef5_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 Custom Coefficient 6 (Reg 145, bits 0 to 10) */
+static inline uint32_t ajareg_get_csconv1coef6(AJA_REGCTX c) { return AJA_REGREAD(c, 0x244u) & 0x000007FFu; }
+static inline uint32_t ajareg_get_csconv1coef6_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 Custom Coefficient 7 (Reg 145, bits 16 to 26) */
+static inline uint32_t ajareg_get_csconv1coef7(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x244u) & 0x07FF0000u) >> 16; }
+static inline uint32_t ajareg_get_csconv1coef7_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 Custom Coefficient 8 (Reg 146, bits 0 to 10) */
+static inline uint32_t ajareg_get_csconv1coef8(AJA_REGCTX c) { return AJA_REGREAD(c, 0x248u) & 0x000007FFu; }
+static inline uint32_t ajareg_get_csconv1coef8_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 Custom Coefficient 9 (Reg 146, bits 16 to 26) */
+static inline uint32_t ajareg_get_csconv1coef9(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x248u) & 0x07FF0000u) >> 16; }
+static inline uint32_t ajareg_get_csconv1coef9_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 use custom coefficents (Reg 142, bits 31 to 31) */
+static inline uint32_t ajareg_get_csconv1customcoef(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x238u) & 0x80000000u) >> 31; }
+static inline uint32_t ajareg_get_csconv1customcoef_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 Coefficient (Reg 142, bits 30 to 30) */
+static inline uint32_t ajareg_get_csconv1mode(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x238u) & 0x40000000u) >> 30; }
+static inline uint32_t ajareg_get_csconv1mode_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 RGB range (Reg 143, bits 31 to 31) */
+static inline uint32_t ajareg_get_csconv1rgbrange(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x23Cu) & 0x80000000u) >> 31; }
+static inline uint32_t ajareg_get_csconv1rgbrange_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 sync fail (Reg 142, bits 28 to 28) */
+static inline uint32_t ajareg_get_csconv1syncfail(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x238u) & 0x10000000u) >> 28; }
+static inline uint32_t ajareg_get_csconv1syncfail_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 Crosspoint (Reg 136, bits 8 to 15) */
+static inline uint32_t ajareg_get_csconv1xpt(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x220u) & 0x0000FF00u) >> 8; }
+static inline uint32_t ajareg_get_csconv1xpt_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 2 make alpha from key (Reg 147, bits 29 to 29) */
+static inline uint32_t ajareg_get_csconv2alphafromkey(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x24Cu) & 0x20000000u) >> 29; }
+static inline uint32_t ajareg_get_csconv2alphafromkey_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 2 Custom Coefficient 0 (Reg 147, bits 0 to 10) */
+static inline uint32_t ajareg_get_csconv2coef0(AJA_REGCTX c) { return AJA_REGREAD(c, 0x24Cu) & 0x000007FFu; }
+static inline uint32_t ajareg_get_csconv2coef0_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 2 Custom Coefficient 1 (Reg 147, bits 16 to 26) */
+static inline uint32_t ajareg_get_csconv2coef1(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x24Cu) & 0x07FF0000u) >> 16; }
+static inline uint32_t ajareg_get_csconv2coef1_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 2 Custom Coefficient 2 (Reg 148, bits 0 to 10) */
+static inline uint32_t ajareg_get_csconv2coef2(AJA_REGCTX c) { return AJA_REGREAD(c, 0x250u) & 0x000007FFu; }
+static inline uint32_t ajareg_get_csconv2coef2_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 2 Custom Coefficient 3 (Reg 148, bits 16 to 26) */
+static inline uint32_t ajareg_get_csconv2coef3(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x250u) & 0x07FF0000u) >> 16; }
+static inline uint32_t ajareg_get_csconv2coef3_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 2 Custom Coefficient 4 (Reg 149, bits 0 to 10) */
+static inline uint32_t ajareg_get_csconv2coef4(AJA_REGCTX c) { return AJA_REGREAD(c, 0x254u) & 0x000007FFu; }
+static inline uint32_t ajareg_get_csconv2coef4_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 2 Custom Coefficient 5 (Reg 149, bits 16 to 26) */
+static inline uint32_t ajareg_get_csconv2coef5(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x254u) & 0x07FF0000u) >> 16; }
+static inline uint32_t ajareg_get_csconv2coef5_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 2 Custom Coefficient 6 (Reg 150, bits 0 to 10) */
+static inline uint32_t ajareg_get_csconv2coef6(AJA_REGCTX c) { return AJA_REGREAD(c, 0x258u) & 0x000007FFu; }
+static inline uint32_t ajareg_get_csconv2coef6_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 2 Custom Coefficient 7 (Reg 150, bits 16 to 26) */
+static inline uint32_t ajareg_get_csconv2coef7(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x258u) & 0x07FF0000u) >> 16; }
+static inline uint32_t ajareg_get_csconv2coef7_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 2 Custom Coefficient 8 (Reg 151, bits 0 to 10) */
+static inline uint32_t ajareg_get_csconv2coef8(AJA_REGCTX c) { return AJA_REGREAD(c, 0x25Cu) & 0x000007FFu; }
+static inline uint32_t ajareg_get_csconv2coef8_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 2 Custom Coefficient 9 (Reg 151, bits 16 to 26) */
+static inline uint32_t ajareg_get_csconv2coef9(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x25Cu) & 0x07FF0000u) >> 16; }
+static inline uint32_t ajareg_get_csconv2coef9_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 2 use custom coefficents (Reg 147, bits 31 to 31) */
+static inline uint32_t ajareg_get_csconv2customcoef(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x24Cu) & 0x80000000u) >> 31; }
+static inline uint32_t ajareg_get_csconv2customcoef_small(AJA_REGCTX c) { return 0; }
+
+/* ColorSpace Converter 2 Key Crosspoint (Reg 140, bits 24 to 31) */
+static inline uint32_t ajareg_get_csconv2keyxpt(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x230u) & 0xFF000000u) >> 24; }
+static inline uint32_t ajareg_get_csconv2keyxpt_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 2 Coefficient (Reg 147, bits 30 to 30) */
+static inline uint32_t ajareg_get_csconv2mode(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x24Cu) & 0x40000000u) >> 30; }
+static inline uint32_t ajareg_get_csconv2mode_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 2 RGB range (Reg 148, bits 31 to 31) */
+static inline uint32_t ajareg_get_csconv2rgbrange(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x250u) & 0x80000000u) >> 31; }
+static inline uint32_t ajareg_get_csconv2rgbrange_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 2 sync fail (Reg 147, bits 28 to 28) */
+static inline uint32_t ajareg_get_csconv2syncfail(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x24Cu) & 0x10000000u) >> 28; }
+static inline uint32_t ajareg_get_csconv2syncfail_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 2 Crosspoint (Reg 140, bits 16 to 23) */
+static inline uint32_t ajareg_get_csconv2xpt(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x230u) & 0x00FF0000u) >> 16; }
+static inline uint32_t ajareg_get_csconv2xpt_small(AJA_REGCTX c) { return 0; }
+
+/* ColorSpace Converter Key Crosspoint (Reg 138, bits 24 to 31) */
+static inline uint32_t ajareg_get_csconvkeyxpt(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x228u) & 0xFF000000u) >> 24; }
+static inline uint32_t ajareg_get_csconvkeyxpt_small(AJA_REGCTX c) { return 0; }
+
+/* Colorspace Converter 1 Crosspoint (Reg 136, bits 8 to 15) */
+static inline uint32_t ajareg_get_csconvxpt(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x220u) & 0x0000FF00u) >> 8; }
+static inline uint32_t ajareg_get_csconvxpt_small(AJA_REGCTX c) { return 0; }
+
+/* Detect 64bit PCI (Reg 48, bits 5 to 5) */
+static inline uint32_t ajareg_get_detect64bit(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC0u) & 0x00000020u) >> 5; }
+#define ajareg_get_detect64bit_small ajareg_get_detect64bit
+
+/* Enable Dual Link Input (Reg 0, bits 23 to 23) */
+static inline uint32_t ajareg_get_dlinput(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x0u) & 0x00800000u) >> 23; }
+#define ajareg_get_dlinput_small ajareg_get_dlinput
+
+/* Enable Dual Link Output (Reg 0, bits 27 to 27) */
+static inline uint32_t ajareg_get_dloutput(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x0u) & 0x08000000u) >> 27; }
+#define ajareg_get_dloutput_small ajareg_get_dloutput
+
+/* Dual-Link Output Crosspoint (Reg 137, bits 24 to 31) */
+static inline uint32_t ajareg_get_dloutxpt(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x224u) & 0xFF000000u) >> 24; }
+static inline uint32_t ajareg_get_dloutxpt_small(AJA_REGCTX c) { return 0; }
+
+/* DMA 1 Busy (Reg 48, bits 0 to 0) */
+static inline uint32_t ajareg_get_dma1busy(AJA_REGCTX c) { return AJA_REGREAD(c, 0xC0u) & 0x00000001u; }
+#define ajareg_get_dma1busy_small ajareg_get_dma1busy
+
+/* DMA 1 Card Address (Reg 33, bits 0 to 29) */
+static inline uint32_t ajareg_get_dma1cadd(AJA_REGCTX c) { return AJA_REGREAD(c, 0x84u) & 0x3FFFFFFFu; }
+#define ajareg_get_dma1cadd_small ajareg_get_dma1cadd
+
+/* DMA 1 Word Count (Reg 34, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma1count(AJA_REGCTX c) { return AJA_REGREAD(c, 0x88u); }
+#define ajareg_get_dma1count_small ajareg_get_dma1count
+
+/* DMA 1 Host Address (Reg 32, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma1hadd(AJA_REGCTX c) { return AJA_REGREAD(c, 0x80u); }
+#define ajareg_get_dma1hadd_small ajareg_get_dma1hadd
+
+/* DMA 1 Host Address (MSB 32) (Reg 100, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma1hadd_high(AJA_REGCTX c) { return AJA_REGREAD(c, 0x190u); }
+static inline uint32_t ajareg_get_dma1hadd_high_small(AJA_REGCTX c) { return 0; }
+
+/* DMA 1 IRQ Active (Reg 48, bits 27 to 27) */
+static inline uint32_t ajareg_get_dma1irq(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC0u) & 0x08000000u) >> 27; }
+#define ajareg_get_dma1irq_small ajareg_get_dma1irq
+
+/* DMA 1 IRQ Enable (Reg 49, bits 0 to 0) */
+static inline uint32_t ajareg_get_dma1irqenable(AJA_REGCTX c) { return AJA_REGREAD(c, 0xC4u) & 0x00000001u; }
+#define ajareg_get_dma1irqenable_small ajareg_get_dma1irqenable
+
+/* DMA 1 Next Descriptor (Reg 35, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma1next(AJA_REGCTX c) { return AJA_REGREAD(c, 0x8Cu); }
+#define ajareg_get_dma1next_small ajareg_get_dma1next
+
+/* DMA 1 Next Descriptor Address (MSB 32) (Reg 101, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma1next_high(AJA_REGCTX c) { return AJA_REGREAD(c, 0x194u); }
+static inline uint32_t ajareg_get_dma1next_high_small(AJA_REGCTX c) { return 0; }
+
+/* DMA 2 Busy (Reg 48, bits 1 to 1) */
+static inline uint32_t ajareg_get_dma2busy(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC0u) & 0x00000002u) >> 1; }
+#define ajareg_get_dma2busy_small ajareg_get_dma2busy
+
+/* DMA 2 Card Address (Reg 37, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma2cadd(AJA_REGCTX c) { return AJA_REGREAD(c, 0x94u); }
+#define ajareg_get_dma2cadd_small ajareg_get_dma2cadd
+
+/* DMA 2 Word Count (Reg 38, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma2count(AJA_REGCTX c) { return AJA_REGREAD(c, 0x98u); }
+#define ajareg_get_dma2count_small ajareg_get_dma2count
+
+/* DMA 2 Host Address (Reg 36, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma2hadd(AJA_REGCTX c) { return AJA_REGREAD(c, 0x90u); }
+#define ajareg_get_dma2hadd_small ajareg_get_dma2hadd
+
+/* DMA 1 Host Address (MSB 32) (Reg 102, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma2hadd_high(AJA_REGCTX c) { return AJA_REGREAD(c, 0x198u); }
+static inline uint32_t ajareg_get_dma2hadd_high_small(AJA_REGCTX c) { return 0; }
+
+/* DMA 2 IRQ Active (Reg 48, bits 28 to 28) */
+static inline uint32_t ajareg_get_dma2irq(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC0u) & 0x10000000u) >> 28; }
+#define ajareg_get_dma2irq_small ajareg_get_dma2irq
+
+/* DMA 2 IRQ Enable (Reg 49, bits 1 to 1) */
+static inline uint32_t ajareg_get_dma2irqenable(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC4u) & 0x00000002u) >> 1; }
+#define ajareg_get_dma2irqenable_small ajareg_get_dma2irqenable
+
+/* DMA 2 Next Descriptor (Reg 39, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma2next(AJA_REGCTX c) { return AJA_REGREAD(c, 0x9Cu); }
+#define ajareg_get_dma2next_small ajareg_get_dma2next
+
+/* DMA 1 Next Descriptor Address (MSB 32) (Reg 103, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma2next_high(AJA_REGCTX c) { return AJA_REGREAD(c, 0x19Cu); }
+static inline uint32_t ajareg_get_dma2next_high_small(AJA_REGCTX c) { return 0; }
+
+/* DMA 3 Busy (Reg 48, bits 2 to 2) */
+static inline uint32_t ajareg_get_dma3busy(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC0u) & 0x00000004u) >> 2; }
+#define ajareg_get_dma3busy_small ajareg_get_dma3busy
+
+/* DMA 3 Card Address (Reg 41, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma3cadd(AJA_REGCTX c) { return AJA_REGREAD(c, 0xA4u); }
+#define ajareg_get_dma3cadd_small ajareg_get_dma3cadd
+
+/* DMA 3 Word Count (Reg 42, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma3count(AJA_REGCTX c) { return AJA_REGREAD(c, 0xA8u); }
+#define ajareg_get_dma3count_small ajareg_get_dma3count
+
+/* DMA 3 Host Address (Reg 40, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma3hadd(AJA_REGCTX c) { return AJA_REGREAD(c, 0xA0u); }
+#define ajareg_get_dma3hadd_small ajareg_get_dma3hadd
+
+/* DMA 1 Host Address (MSB 32) (Reg 104, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma3hadd_high(AJA_REGCTX c) { return AJA_REGREAD(c, 0x1A0u); }
+static inline uint32_t ajareg_get_dma3hadd_high_small(AJA_REGCTX c) { return 0; }
+
+/* DMA 3 IRQ Active (Reg 48, bits 29 to 29) */
+static inline uint32_t ajareg_get_dma3irq(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC0u) & 0x20000000u) >> 29; }
+#define ajareg_get_dma3irq_small ajareg_get_dma3irq
+
+/* DMA 3 IRQ Enable (Reg 49, bits 2 to 2) */
+static inline uint32_t ajareg_get_dma3irqenable(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC4u) & 0x00000004u) >> 2; }
+#define ajareg_get_dma3irqenable_small ajareg_get_dma3irqenable
+
+/* DMA 3 Next Descriptor (Reg 43, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma3next(AJA_REGCTX c) { return AJA_REGREAD(c, 0xACu); }
+#define ajareg_get_dma3next_small ajareg_get_dma3next
+
+/* DMA 1 Next Descriptor Address (MSB 32) (Reg 105, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma3next_high(AJA_REGCTX c) { return AJA_REGREAD(c, 0x1A4u); }
+static inline uint32_t ajareg_get_dma3next_high_small(AJA_REGCTX c) { return 0; }
+
+/* DMA 4 Busy (Reg 48, bits 3 to 3) */
+static inline uint32_t ajareg_get_dma4busy(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC0u) & 0x00000008u) >> 3; }
+#define ajareg_get_dma4busy_small ajareg_get_dma4busy
+
+/* DMA 1 Host Address (MSB 32) (Reg 106, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma4hadd_high(AJA_REGCTX c) { return AJA_REGREAD(c, 0x1A8u); }
+static inline uint32_t ajareg_get_dma4hadd_high_small(AJA_REGCTX c) { return 0; }
+
+/* DMA 4 IRQ Active (Reg 48, bits 30 to 30) */
+static inline uint32_t ajareg_get_dma4irq(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC0u) & 0x40000000u) >> 30; }
+#define ajareg_get_dma4irq_small ajareg_get_dma4irq
+
+/* DMA 4 IRQ Enable (Reg 49, bits 3 to 3) */
+static inline uint32_t ajareg_get_dma4irqenable(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC4u) & 0x00000008u) >> 3; }
+#define ajareg_get_dma4irqenable_small ajareg_get_dma4irqenable
+
+/* DMA 1 Next Descriptor Address (MSB 32) (Reg 107, bits 0 to 31) */
+static inline uint32_t ajareg_get_dma4next_high(AJA_REGCTX c) { return AJA_REGREAD(c, 0x1ACu); }
+static inline uint32_t ajareg_get_dma4next_high_small(AJA_REGCTX c) { return 0; }
+
+/* DMA Status (whole register) (Reg 48, bits 0 to 31) */
+static inline uint32_t ajareg_get_dmastatus(AJA_REGCTX c) { return AJA_REGREAD(c, 0xC0u); }
+#define ajareg_get_dmastatus_small ajareg_get_dmastatus
+
+/* Downconversion Mode (Reg 131, bits 4 to 5) */
+static inline uint32_t ajareg_get_downconvmode(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x20Cu) & 0x00000030u) >> 4; }
+static inline uint32_t ajareg_get_downconvmode_small(AJA_REGCTX c) { return 0; }
+
+/* Embedded Audio Group 1 - Ch 1/2 Present (Reg 23, bits 0 to 0) */
+static inline uint32_t ajareg_get_eaud1c12(AJA_REGCTX c) { return AJA_REGREAD(c, 0x5Cu) & 0x00000001u; }
+#define ajareg_get_eaud1c12_small ajareg_get_eaud1c12
+
+/* Embedded Audio Group 1 - Ch 3/4 Present (Reg 23, bits 1 to 1) */
+static inline uint32_t ajareg_get_eaud1c34(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x5Cu) & 0x00000002u) >> 1; }
+#define ajareg_get_eaud1c34_small ajareg_get_eaud1c34
+
+/* Output 1 Embedded Audio Supress (Reg 24, bits 13 to 13) */
+static inline uint32_t ajareg_get_eaud1supress(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00002000u) >> 13; }
+#define ajareg_get_eaud1supress_small ajareg_get_eaud1supress
+
+/* Embedded Audio Group 2 - Ch 1/2 Present (Reg 23, bits 2 to 2) */
+static inline uint32_t ajareg_get_eaud2c12(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x5Cu) & 0x00000004u) >> 2; }
+#define ajareg_get_eaud2c12_small ajareg_get_eaud2c12
+
+/* Embedded Audio Group 2 - Ch 3/4 Present (Reg 23, bits 3 to 3) */
+static inline uint32_t ajareg_get_eaud2c34(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x5Cu) & 0x00000008u) >> 3; }
+#define ajareg_get_eaud2c34_small ajareg_get_eaud2c34
+
+/* Output 2 Embedded Audio Supress (Reg 24, bits 15 to 15) */
+static inline uint32_t ajareg_get_eaud2supress(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00008000u) >> 15; }
+#define ajareg_get_eaud2supress_small ajareg_get_eaud2supress
+
+/* Embedded Audio Group 3 - Ch 1/2 Present (Reg 23, bits 4 to 4) */
+static inline uint32_t ajareg_get_eaud3c12(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x5Cu) & 0x00000010u) >> 4; }
+#define ajareg_get_eaud3c12_small ajareg_get_eaud3c12
+
+/* Embedded Audio Group 3 - Ch 3/4 Present (Reg 23, bits 5 to 5) */
+static inline uint32_t ajareg_get_eaud3c34(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x5Cu) & 0x00000020u) >> 5; }
+#define ajareg_get_eaud3c34_small ajareg_get_eaud3c34
+
+/* Embedded Audio Group 4 - Ch 1/2 Present (Reg 23, bits 6 to 6) */
+static inline uint32_t ajareg_get_eaud4c12(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x5Cu) & 0x00000040u) >> 6; }
+#define ajareg_get_eaud4c12_small ajareg_get_eaud4c12
+
+/* Embedded Audio Group 4 - Ch 3/4 Present (Reg 23, bits 7 to 7) */
+static inline uint32_t ajareg_get_eaud4c34(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x5Cu) & 0x00000080u) >> 7; }
+#define ajareg_get_eaud4c34_small ajareg_get_eaud4c34
+
+/* Embedded Audio Input Select (Reg 25, bits 16 to 16) */
+static inline uint32_t ajareg_get_eaudselect(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x64u) & 0x00010000u) >> 16; }
+#define ajareg_get_eaudselect_small ajareg_get_eaudselect
+
+/* Embedded Audio Supported (Reg 24, bits 22 to 22) */
+static inline uint32_t ajareg_get_eaudsup(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x00400000u) >> 22; }
+#define ajareg_get_eaudsup_small ajareg_get_eaudsup
+
+/* Firmware Revision Number (Reg 48, bits 8 to 15) */
+static inline uint32_t ajareg_get_firmwarerev(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC0u) & 0x0000FF00u) >> 8; }
+#define ajareg_get_firmwarerev_small ajareg_get_firmwarerev
+
+/* Force card to use 64bit PCI (Reg 48, bits 4 to 4) */
+static inline uint32_t ajareg_get_force64bit(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC0u) & 0x00000010u) >> 4; }
+#define ajareg_get_force64bit_small ajareg_get_force64bit
+
+/* FPGA Version Number (Reg 21, bits 4 to 11) */
+static inline uint32_t ajareg_get_fpgaversion(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x54u) & 0x00000FF0u) >> 4; }
+#define ajareg_get_fpgaversion_small ajareg_get_fpgaversion
+
+/* Frame Geometry (Reg 0, bits 3 to 6) */
+static inline uint32_t ajareg_get_framegeo(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x0u) & 0x00000078u) >> 3; }
+#define ajareg_get_framegeo_small ajareg_get_framegeo
+
+/* Frame Rate (Reg 0, bits 0 to 2) */
+static inline uint32_t ajareg_get_framerate(AJA_REGCTX c) { return AJA_REGREAD(c, 0x0u) & 0x00000007u; }
+#define ajareg_get_framerate_small ajareg_get_framerate
+
+/* Extra bit for 2k framerates (Reg 0, bits 22 to 22) */
+static inline uint32_t ajareg_get_framerate2k(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x0u) & 0x00400000u) >> 22; }
+#define ajareg_get_framerate2k_small ajareg_get_framerate2k
+
+/* Horizontal Timing (Reg 14, bits 0 to 15) */
+static inline uint32_t ajareg_get_horiztiming(AJA_REGCTX c) { return AJA_REGREAD(c, 0x38u) & 0x0000FFFFu; }
+#define ajareg_get_horiztiming_small ajareg_get_horiztiming
+
+/* Input Converter Standard (Reg 131, bits 0 to 2) */
+static inline uint32_t ajareg_get_inconvstd(AJA_REGCTX c) { return AJA_REGREAD(c, 0x20Cu) & 0x00000007u; }
+static inline uint32_t ajareg_get_inconvstd_small(AJA_REGCTX c) { return 0; }
+
+/* Input 1 Autotime (Reg 22, bits 3 to 3) */
+static inline uint32_t ajareg_get_input1autotime(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x00000008u) >> 3; }
+#define ajareg_get_input1autotime_small ajareg_get_input1autotime
+
+/* Input 1 Extended Frame Rate (Reg 22, bits 28 to 28) */
+static inline uint32_t ajareg_get_input1extframerate(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x10000000u) >> 28; }
+#define ajareg_get_input1extframerate_small ajareg_get_input1extframerate
+
+/* Input 1 Extended Geometry (Reg 22, bits 30 to 30) */
+static inline uint32_t ajareg_get_input1extgeo(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x40000000u) >> 30; }
+#define ajareg_get_input1extgeo_small ajareg_get_input1extgeo
+
+/* Input 1 Field (Reg 21, bits 21 to 21) */
+static inline uint32_t ajareg_get_input1field(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x54u) & 0x00200000u) >> 21; }
+#define ajareg_get_input1field_small ajareg_get_input1field
+
+/* Input 1 Format (Reg 22, bits 4 to 6) */
+static inline uint32_t ajareg_get_input1format(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x00000070u) >> 4; }
+#define ajareg_get_input1format_small ajareg_get_input1format
+
+/* Input 1 Frame Rate (Reg 22, bits 0 to 2) */
+static inline uint32_t ajareg_get_input1framerate(AJA_REGCTX c) { return AJA_REGREAD(c, 0x58u) & 0x00000007u; }
+#define ajareg_get_input1framerate_small ajareg_get_input1framerate
+
+/* Input 1 IRQ Active (Reg 21, bits 30 to 30) */
+static inline uint32_t ajareg_get_input1irq(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x54u) & 0x40000000u) >> 30; }
+#define ajareg_get_input1irq_small ajareg_get_input1irq
+
+/* Input1 IRQ Enable (Reg 20, bits 1 to 1) */
+static inline uint32_t ajareg_get_input1irqenable(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x50u) & 0x00000002u) >> 1; }
+#define ajareg_get_input1irqenable_small ajareg_get_input1irqenable
+
+/* Input 1 Progressive Flag (Reg 22, bits 7 to 7) */
+static inline uint32_t ajareg_get_input1prog(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x00000080u) >> 7; }
+#define ajareg_get_input1prog_small ajareg_get_input1prog
+
+/* Input 1 Vertical Blank Active (Reg 21, bits 20 to 20) */
+static inline uint32_t ajareg_get_input1vblank(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x54u) & 0x00100000u) >> 20; }
+#define ajareg_get_input1vblank_small ajareg_get_input1vblank
+
+/* Input 2 Autotime (Reg 22, bits 11 to 11) */
+static inline uint32_t ajareg_get_input2autotime(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x00000800u) >> 11; }
+#define ajareg_get_input2autotime_small ajareg_get_input2autotime
+
+/* Input 2 Extended Frame Rave (Reg 22, bits 29 to 29) */
+static inline uint32_t ajareg_get_input2extframerate(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x20000000u) >> 29; }
+#define ajareg_get_input2extframerate_small ajareg_get_input2extframerate
+
+/* Input 2 Extended Frame Geometry (Reg 22, bits 31 to 31) */
+static inline uint32_t ajareg_get_input2extgeo(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x80000000u) >> 31; }
+#define ajareg_get_input2extgeo_small ajareg_get_input2extgeo
+
+/* Input 2 Field (Reg 21, bits 19 to 19) */
+static inline uint32_t ajareg_get_input2field(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x54u) & 0x00080000u) >> 19; }
+#define ajareg_get_input2field_small ajareg_get_input2field
+
+/* Input 2 Format (Reg 22, bits 12 to 14) */
+static inline uint32_t ajareg_get_input2format(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x00007000u) >> 12; }
+#define ajareg_get_input2format_small ajareg_get_input2format
+
+/* Input 2 Frame Rate (Reg 22, bits 8 to 10) */
+static inline uint32_t ajareg_get_input2framerate(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x00000700u) >> 8; }
+#define ajareg_get_input2framerate_small ajareg_get_input2framerate
+
+/* Input 2 IRQ Active (Reg 21, bits 29 to 29) */
+static inline uint32_t ajareg_get_input2irq(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x54u) & 0x20000000u) >> 29; }
+#define ajareg_get_input2irq_small ajareg_get_input2irq
+
+/* Input2 IRQ Enable (Reg 20, bits 2 to 2) */
+static inline uint32_t ajareg_get_input2irqenable(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x50u) & 0x00000004u) >> 2; }
+#define ajareg_get_input2irqenable_small ajareg_get_input2irqenable
+
+/* Input 2 Progressive Flag (Reg 22, bits 15 to 15) */
+static inline uint32_t ajareg_get_input2prog(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x00008000u) >> 15; }
+#define ajareg_get_input2prog_small ajareg_get_input2prog
+
+/* Input 2 Vertical Blank Active (Reg 21, bits 18 to 18) */
+static inline uint32_t ajareg_get_input2vblank(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x54u) & 0x00040000u) >> 18; }
+#define ajareg_get_input2vblank_small ajareg_get_input2vblank
+
+/* IRQ Status (whole register) (Reg 21, bits 0 to 31) */
+static inline uint32_t ajareg_get_irqstatus(AJA_REGCTX c) { return AJA_REGREAD(c, 0x54u); }
+#define ajareg_get_irqstatus_small ajareg_get_irqstatus
+
+/* KBOX Input Selection (Reg 24, bits 26 to 26) */
+static inline uint32_t ajareg_get_kboxinput(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x04000000u) >> 26; }
+#define ajareg_get_kboxinput_small ajareg_get_kboxinput
+
+/* KBOX Audio Monitor Output (Reg 24, bits 24 to 25) */
+static inline uint32_t ajareg_get_kboxmonitor(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x60u) & 0x03000000u) >> 24; }
+#define ajareg_get_kboxmonitor_small ajareg_get_kboxmonitor
+
+/* Card LEDs (Reg 0, bits 16 to 19) */
+static inline uint32_t ajareg_get_leds(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x0u) & 0x000F0000u) >> 16; }
+#define ajareg_get_leds_small ajareg_get_leds
+
+/* LUT 1 Crosspoint (Reg 136, bits 0 to 7) */
+static inline uint32_t ajareg_get_lut1xpt(AJA_REGCTX c) { return AJA_REGREAD(c, 0x220u) & 0x000000FFu; }
+static inline uint32_t ajareg_get_lut1xpt_small(AJA_REGCTX c) { return 0; }
+
+/* LUT 2 Crosspoint (Reg 140, bits 8 to 15) */
+static inline uint32_t ajareg_get_lut2xpt(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x230u) & 0x0000FF00u) >> 8; }
+static inline uint32_t ajareg_get_lut2xpt_small(AJA_REGCTX c) { return 0; }
+
+/* Matte Cb Value (Reg 13, bits 0 to 9) */
+static inline uint32_t ajareg_get_mattecb(AJA_REGCTX c) { return AJA_REGREAD(c, 0x34u) & 0x000003FFu; }
+#define ajareg_get_mattecb_small ajareg_get_mattecb
+
+/* Matte Cr Value (Reg 13, bits 20 to 29) */
+static inline uint32_t ajareg_get_mattecr(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x34u) & 0x3FF00000u) >> 20; }
+#define ajareg_get_mattecr_small ajareg_get_mattecr
+
+/* Matte Y Value (Reg 13, bits 10 to 19) */
+static inline uint32_t ajareg_get_mattey(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x34u) & 0x000FFC00u) >> 10; }
+#define ajareg_get_mattey_small ajareg_get_mattey
+
+/* Mixer Background Key Crosspoint (Reg 139, bits 24 to 31) */
+static inline uint32_t ajareg_get_mixbgkeyxpt(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x22Cu) & 0xFF000000u) >> 24; }
+static inline uint32_t ajareg_get_mixbgkeyxpt_small(AJA_REGCTX c) { return 0; }
+
+/* Mixer Background Video Crosspoint (Reg 139, bits 16 to 23) */
+static inline uint32_t ajareg_get_mixbgvidxpt(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x22Cu) & 0x00FF0000u) >> 16; }
+static inline uint32_t ajareg_get_mixbgvidxpt_small(AJA_REGCTX c) { return 0; }
+
+/* Mixer Value (Reg 11, bits 0 to 31) */
+static inline uint32_t ajareg_get_mixer(AJA_REGCTX c) { return AJA_REGREAD(c, 0x2Cu); }
+#define ajareg_get_mixer_small ajareg_get_mixer
+
+/* Mixer Foreground Key Crosspoint (Reg 139, bits 8 to 15) */
+static inline uint32_t ajareg_get_mixfgkeyxpt(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x22Cu) & 0x0000FF00u) >> 8; }
+static inline uint32_t ajareg_get_mixfgkeyxpt_small(AJA_REGCTX c) { return 0; }
+
+/* Mixer Foreground Video Crosspoint (Reg 139, bits 0 to 7) */
+static inline uint32_t ajareg_get_mixfgvidxpt(AJA_REGCTX c) { return AJA_REGREAD(c, 0x22Cu) & 0x000000FFu; }
+static inline uint32_t ajareg_get_mixfgvidxpt_small(AJA_REGCTX c) { return 0; }
+
+/* Output Converter Standard (Reg 131, bits 12 to 14) */
+static inline uint32_t ajareg_get_outconvstd(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x20Cu) & 0x00007000u) >> 12; }
+static inline uint32_t ajareg_get_outconvstd_small(AJA_REGCTX c) { return 0; }
+
+/* Output Field (Reg 21, bits 23 to 23) */
+static inline uint32_t ajareg_get_outputfield(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x54u) & 0x00800000u) >> 23; }
+#define ajareg_get_outputfield_small ajareg_get_outputfield
+
+/* Output Active (Reg 21, bits 31 to 31) */
+static inline uint32_t ajareg_get_outputirq(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x54u) & 0x80000000u) >> 31; }
+#define ajareg_get_outputirq_small ajareg_get_outputirq
+
+/* Output IRQ Enable (Reg 20, bits 0 to 0) */
+static inline uint32_t ajareg_get_outputirqenable(AJA_REGCTX c) { return AJA_REGREAD(c, 0x50u) & 0x00000001u; }
+#define ajareg_get_outputirqenable_small ajareg_get_outputirqenable
+
+/* Output Line Number (Reg 18, bits 0 to 31) */
+static inline uint32_t ajareg_get_outputline(AJA_REGCTX c) { return AJA_REGREAD(c, 0x48u); }
+#define ajareg_get_outputline_small ajareg_get_outputline
+
+/* Output Vertical Blank Active (Reg 21, bits 22 to 22) */
+static inline uint32_t ajareg_get_outputvblank(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x54u) & 0x00400000u) >> 22; }
+#define ajareg_get_outputvblank_small ajareg_get_outputvblank
+
+/* Pan Horizontal Offset (Reg 15, bits 0 to 11) */
+static inline uint32_t ajareg_get_panhoriz(AJA_REGCTX c) { return AJA_REGREAD(c, 0x3Cu) & 0x00000FFFu; }
+#define ajareg_get_panhoriz_small ajareg_get_panhoriz
+
+/* Pan Vertical Offset (Reg 15, bits 12 to 23) */
+static inline uint32_t ajareg_get_panvert(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x3Cu) & 0x00FFF000u) >> 12; }
+#define ajareg_get_panvert_small ajareg_get_panvert
+
+/* Pan window size (Reg 15, bits 30 to 31) */
+static inline uint32_t ajareg_get_panwindow(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x3Cu) & 0xC0000000u) >> 30; }
+#define ajareg_get_panwindow_small ajareg_get_panwindow
+
+/* Reference Format (Reg 22, bits 20 to 22) */
+static inline uint32_t ajareg_get_refformat(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x00700000u) >> 20; }
+#define ajareg_get_refformat_small ajareg_get_refformat
+
+/* Reference Frame Rate (Reg 22, bits 16 to 19) */
+static inline uint32_t ajareg_get_refframerate(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x000F0000u) >> 16; }
+#define ajareg_get_refframerate_small ajareg_get_refframerate
+
+/* Reference Progressive Flag (Reg 22, bits 23 to 23) */
+static inline uint32_t ajareg_get_refprog(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x58u) & 0x00800000u) >> 23; }
+#define ajareg_get_refprog_small ajareg_get_refprog
+
+/* Reference Source (Reg 0, bits 10 to 11) */
+static inline uint32_t ajareg_get_refsource(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x0u) & 0x00000C00u) >> 10; }
+#define ajareg_get_refsource_small ajareg_get_refsource
+
+/* Reference Voltage (Reg 0, bits 12 to 12) */
+static inline uint32_t ajareg_get_refvoltage(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x0u) & 0x00001000u) >> 12; }
+#define ajareg_get_refvoltage_small ajareg_get_refvoltage
+
+/* Register Clocking (Reg 0, bits 20 to 21) */
+static inline uint32_t ajareg_get_regclocking(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x0u) & 0x00300000u) >> 20; }
+#define ajareg_get_regclocking_small ajareg_get_regclocking
+
+/* Resolution converter add 2:3 (Reg 131, bits 6 to 6) */
+static inline uint32_t ajareg_get_resconv23(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x20Cu) & 0x00000040u) >> 6; }
+static inline uint32_t ajareg_get_resconv23_small(AJA_REGCTX c) { return 0; }
+
+/* SD Anamorphic Conversion Mode (Reg 131, bits 20 to 21) */
+static inline uint32_t ajareg_get_resconvsdanim(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x20Cu) & 0x00300000u) >> 20; }
+static inline uint32_t ajareg_get_resconvsdanim_small(AJA_REGCTX c) { return 0; }
+
+/* Up/Down Converter Crosspoint (Reg 136, bits 16 to 23) */
+static inline uint32_t ajareg_get_resconvxpt(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x220u) & 0x00FF0000u) >> 16; }
+static inline uint32_t ajareg_get_resconvxpt_small(AJA_REGCTX c) { return 0; }
+
+/* SDI 1 Output 2048x1080 mode (Reg 129, bits 3 to 3) */
+static inline uint32_t ajareg_get_sdi1out2kline(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x204u) & 0x00000008u) >> 3; }
+static inline uint32_t ajareg_get_sdi1out2kline_small(AJA_REGCTX c) { return 0; }
+
+/* SDI 1 Output HBlank RGB range (Reg 129, bits 7 to 7) */
+static inline uint32_t ajareg_get_sdi1outhblankrgb(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x204u) & 0x00000080u) >> 7; }
+static inline uint32_t ajareg_get_sdi1outhblankrgb_small(AJA_REGCTX c) { return 0; }
+
+/* SDI 1 Output Standard (Reg 129, bits 0 to 2) */
+static inline uint32_t ajareg_get_sdi1outstd(AJA_REGCTX c) { return AJA_REGREAD(c, 0x204u) & 0x00000007u; }
+static inline uint32_t ajareg_get_sdi1outstd_small(AJA_REGCTX c) { return 0; }
+
+/* SDI 1 Output Crosspoint (Reg 138, bits 8 to 15) */
+static inline uint32_t ajareg_get_sdi1outxpt(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x228u) & 0x0000FF00u) >> 8; }
+static inline uint32_t ajareg_get_sdi1outxpt_small(AJA_REGCTX c) { return 0; }
+
+/* SDI 2 Output 2048x1080 mode (Reg 130, bits 3 to 3) */
+static inline uint32_t ajareg_get_sdi2out2kline(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x208u) & 0x00000008u) >> 3; }
+static inline uint32_t ajareg_get_sdi2out2kline_small(AJA_REGCTX c) { return 0; }
+
+/* SDI 2 Output HBlank RGB range (Reg 130, bits 7 to 7) */
+static inline uint32_t ajareg_get_sdi2outhblankrgb(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x208u) & 0x00000080u) >> 7; }
+static inline uint32_t ajareg_get_sdi2outhblankrgb_small(AJA_REGCTX c) { return 0; }
+
+/* SDI 2 Output Standard (Reg 130, bits 0 to 2) */
+static inline uint32_t ajareg_get_sdi2outstd(AJA_REGCTX c) { return AJA_REGREAD(c, 0x208u) & 0x00000007u; }
+static inline uint32_t ajareg_get_sdi2outstd_small(AJA_REGCTX c) { return 0; }
+
+/* SDI 2 Output Crosspoint (Reg 138, bits 16 to 23) */
+static inline uint32_t ajareg_get_sdi2outxpt(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x228u) & 0x00FF0000u) >> 16; }
+static inline uint32_t ajareg_get_sdi2outxpt_small(AJA_REGCTX c) { return 0; }
+
+/* Board Serial High (Reg 55, bits 0 to 31) */
+static inline uint32_t ajareg_get_serialhigh(AJA_REGCTX c) { return AJA_REGREAD(c, 0xDCu); }
+#define ajareg_get_serialhigh_small ajareg_get_serialhigh
+
+/* Board Serial Low (Reg 54, bits 0 to 31) */
+static inline uint32_t ajareg_get_seriallow(AJA_REGCTX c) { return AJA_REGREAD(c, 0xD8u); }
+#define ajareg_get_seriallow_small ajareg_get_seriallow
+
+/* Split Screen Slope (Reg 12, bits 16 to 29) */
+static inline uint32_t ajareg_get_splitslope(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x30u) & 0x3FFF0000u) >> 16; }
+#define ajareg_get_splitslope_small ajareg_get_splitslope
+
+/* Split Screen Start (Reg 12, bits 0 to 15) */
+static inline uint32_t ajareg_get_splitstart(AJA_REGCTX c) { return AJA_REGREAD(c, 0x30u) & 0x0000FFFFu; }
+#define ajareg_get_splitstart_small ajareg_get_splitstart
+
+/* Split Screen Type (Reg 12, bits 30 to 31) */
+static inline uint32_t ajareg_get_splittype(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x30u) & 0xC0000000u) >> 30; }
+#define ajareg_get_splittype_small ajareg_get_splittype
+
+/* Video Standard (Reg 0, bits 7 to 9) */
+static inline uint32_t ajareg_get_standard(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x0u) & 0x00000380u) >> 7; }
+#define ajareg_get_standard_small ajareg_get_standard
+
+/* Strap Resistor Enabled (Reg 48, bits 7 to 7) */
+static inline uint32_t ajareg_get_strapenabled(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC0u) & 0x00000080u) >> 7; }
+#define ajareg_get_strapenabled_small ajareg_get_strapenabled
+
+/* UART recieve enable (Reg 72, bits 3 to 3) */
+static inline uint32_t ajareg_get_uartenablerx(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x120u) & 0x00000008u) >> 3; }
+static inline uint32_t ajareg_get_uartenablerx_small(AJA_REGCTX c) { return 0; }
+
+/* UART transmit enable (Reg 72, bits 0 to 0) */
+static inline uint32_t ajareg_get_uartenabletx(AJA_REGCTX c) { return AJA_REGREAD(c, 0x120u) & 0x00000001u; }
+static inline uint32_t ajareg_get_uartenabletx_small(AJA_REGCTX c) { return 0; }
+
+/* UART recieve data (Reg 71, bits 0 to 7) */
+static inline uint32_t ajareg_get_uartin(AJA_REGCTX c) { return AJA_REGREAD(c, 0x11Cu) & 0x000000FFu; }
+static inline uint32_t ajareg_get_uartin_small(AJA_REGCTX c) { return 0; }
+
+/* UART Rx IRQ Active (Reg 21, bits 15 to 15) */
+static inline uint32_t ajareg_get_uartrxirq(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x54u) & 0x00008000u) >> 15; }
+#define ajareg_get_uartrxirq_small ajareg_get_uartrxirq
+
+/* UART Rx IRQ Enable (Reg 20, bits 8 to 8) */
+static inline uint32_t ajareg_get_uartrxirqenable(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x50u) & 0x00000100u) >> 8; }
+#define ajareg_get_uartrxirqenable_small ajareg_get_uartrxirqenable
+
+/* UART rx fifo overrun (Reg 72, bits 7 to 7) */
+static inline uint32_t ajareg_get_uartrxoverrun(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x120u) & 0x00000080u) >> 7; }
+static inline uint32_t ajareg_get_uartrxoverrun_small(AJA_REGCTX c) { return 0; }
+
+/* UART rx parity error (Reg 72, bits 6 to 6) */
+static inline uint32_t ajareg_get_uartrxparityerror(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x120u) & 0x00000040u) >> 6; }
+static inline uint32_t ajareg_get_uartrxparityerror_small(AJA_REGCTX c) { return 0; }
+
+/* UART recieve status (Reg 72, bits 4 to 7) */
+static inline uint32_t ajareg_get_uartstatusrx(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x120u) & 0x000000F0u) >> 4; }
+static inline uint32_t ajareg_get_uartstatusrx_small(AJA_REGCTX c) { return 0; }
+
+/* UART transmit fifo status (Reg 72, bits 1 to 2) */
+static inline uint32_t ajareg_get_uartstatustx(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x120u) & 0x00000006u) >> 1; }
+static inline uint32_t ajareg_get_uartstatustx_small(AJA_REGCTX c) { return 0; }
+
+/* UART Tx IRQ Active (Reg 21, bits 24 to 24) */
+static inline uint32_t ajareg_get_uarttxirq(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x54u) & 0x01000000u) >> 24; }
+#define ajareg_get_uarttxirq_small ajareg_get_uarttxirq
+
+/* UART Tx IRQ Enable (Reg 20, bits 7 to 7) */
+static inline uint32_t ajareg_get_uarttxirqenable(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x50u) & 0x00000080u) >> 7; }
+#define ajareg_get_uarttxirqenable_small ajareg_get_uarttxirqenable
+
+/* Upconversion Mode (Reg 131, bits 8 to 10) */
+static inline uint32_t ajareg_get_upconvmode(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x20Cu) & 0x00000700u) >> 8; }
+static inline uint32_t ajareg_get_upconvmode_small(AJA_REGCTX c) { return 0; }
+
+/* Vertical Timing (Reg 14, bits 16 to 31) */
+static inline uint32_t ajareg_get_verttiming(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x38u) & 0xFFFF0000u) >> 16; }
+#define ajareg_get_verttiming_small ajareg_get_verttiming
+
+/* Video Firmware Done (Reg 17, bits 9 to 9) */
+static inline uint32_t ajareg_get_vidfw_done(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x44u) & 0x00000200u) >> 9; }
+#define ajareg_get_vidfw_done_small ajareg_get_vidfw_done
+
+/* Video Firmware Programming PCI-X programming mode (Reg 17, bits 29 to 29) */
+static inline uint32_t ajareg_get_vidfw_pcix(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x44u) & 0x20000000u) >> 29; }
+#define ajareg_get_vidfw_pcix_small ajareg_get_vidfw_pcix
+
+/* Video Firmware Ready (Reg 17, bits 8 to 8) */
+static inline uint32_t ajareg_get_vidfw_ready(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x44u) & 0x00000100u) >> 8; }
+#define ajareg_get_vidfw_ready_small ajareg_get_vidfw_ready
+
+/* Virtex Interrupt Validation (Reg 48, bits 26 to 26) */
+static inline uint32_t ajareg_get_viv(AJA_REGCTX c) { return (AJA_REGREAD(c, 0xC0u) & 0x04000000u) >> 26; }
+#define ajareg_get_viv_small ajareg_get_viv
+
+/* Video Processing Control - Background Control (Reg 9, bits 22 to 23) */
+static inline uint32_t ajareg_get_vpc_bgcont(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x24u) & 0x00C00000u) >> 22; }
+#define ajareg_get_vpc_bgcont_small ajareg_get_vpc_bgcont
+
+/* Video Processing Control - Foreground Control (Reg 9, bits 20 to 21) */
+static inline uint32_t ajareg_get_vpc_fgcont(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x24u) & 0x00300000u) >> 20; }
+#define ajareg_get_vpc_fgcont_small ajareg_get_vpc_fgcont
+
+/* Video Processing Control - Limiting (Reg 9, bits 11 to 12) */
+static inline uint32_t ajareg_get_vpc_limiting(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x24u) & 0x00001800u) >> 11; }
+#define ajareg_get_vpc_limiting_small ajareg_get_vpc_limiting
+
+/* Video Processing Control - Mode (Reg 9, bits 24 to 25) */
+static inline uint32_t ajareg_get_vpc_mode(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x24u) & 0x03000000u) >> 24; }
+#define ajareg_get_vpc_mode_small ajareg_get_vpc_mode
+
+/* Video Processing Control - Mux1 (Reg 9, bits 0 to 1) */
+static inline uint32_t ajareg_get_vpc_mux1(AJA_REGCTX c) { return AJA_REGREAD(c, 0x24u) & 0x00000003u; }
+#define ajareg_get_vpc_mux1_small ajareg_get_vpc_mux1
+
+/* Video Processing Control - Mux2 (Reg 9, bits 2 to 3) */
+static inline uint32_t ajareg_get_vpc_mux2(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x24u) & 0x0000000Cu) >> 2; }
+#define ajareg_get_vpc_mux2_small ajareg_get_vpc_mux2
+
+/* Video Processint Control - Mux3 (Reg 9, bits 4 to 5) */
+static inline uint32_t ajareg_get_vpc_mux3(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x24u) & 0x00000030u) >> 4; }
+#define ajareg_get_vpc_mux3_small ajareg_get_vpc_mux3
+
+/* Video Processing Control - Mux4 (Reg 9, bits 6 to 7) */
+static inline uint32_t ajareg_get_vpc_mux4(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x24u) & 0x000000C0u) >> 6; }
+#define ajareg_get_vpc_mux4_small ajareg_get_vpc_mux4
+
+/* Video Processing Control - Mux5 (Reg 9, bits 8 to 10) */
+static inline uint32_t ajareg_get_vpc_mux5(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x24u) & 0x00000700u) >> 8; }
+#define ajareg_get_vpc_mux5_small ajareg_get_vpc_mux5
+
+/* Video Processing Control - Standard (Reg 9, bits 28 to 30) */
+static inline uint32_t ajareg_get_vpc_standard(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x24u) & 0x70000000u) >> 28; }
+#define ajareg_get_vpc_standard_small ajareg_get_vpc_standard
+
+/* Video Processing Control - Sync Fail (Reg 9, bits 27 to 27) */
+static inline uint32_t ajareg_get_vpc_syncfail(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x24u) & 0x08000000u) >> 27; }
+#define ajareg_get_vpc_syncfail_small ajareg_get_vpc_syncfail
+
+/* Video Processing Crosspoint - Background Key (Reg 10, bits 12 to 14) */
+static inline uint32_t ajareg_get_vpcc_bgkey(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x28u) & 0x00007000u) >> 12; }
+#define ajareg_get_vpcc_bgkey_small ajareg_get_vpcc_bgkey
+
+/* Video Processing Crosspoint - Background Video (Reg 10, bits 4 to 6) */
+static inline uint32_t ajareg_get_vpcc_bgv(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x28u) & 0x00000070u) >> 4; }
+#define ajareg_get_vpcc_bgv_small ajareg_get_vpcc_bgv
+
+/* Video Processing Crosspoint - Foreground Key (Reg 10, bits 8 to 10) */
+static inline uint32_t ajareg_get_vpcc_fgkey(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x28u) & 0x00000700u) >> 8; }
+#define ajareg_get_vpcc_fgkey_small ajareg_get_vpcc_fgkey
+
+/* Video Processing Crosspoint - Foreground Video (Reg 10, bits 0 to 2) */
+static inline uint32_t ajareg_get_vpcc_fgv(AJA_REGCTX c) { return AJA_REGREAD(c, 0x28u) & 0x00000007u; }
+#define ajareg_get_vpcc_fgv_small ajareg_get_vpcc_fgv
+
+/* Video Processing Crosspoint - Secondary Video (Reg 10, bits 16 to 18) */
+static inline uint32_t ajareg_get_vpcc_secv(AJA_REGCTX c) { return (AJA_REGREAD(c, 0x28u) & 0x00070000u) >> 16; }
+#define ajareg_get_vpcc_secv_small ajareg_get_vpcc_secv
+
+
+/* Setters, only for a context that defines the write macros (the driver) */
+#ifdef AJA_REGWRITE
+
+/* 1080p50/60 dual link output enable (Reg 0, bits 15 to 15) */
+static inline void ajareg_set_1080pdual(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x0u, 0x00008000u, v << 15); }
+#define ajareg_set_1080pdual_small ajareg_set_1080pdual
+
+/* Audio Capture Enable (Reg 24, bits 0 to 0) */
+static inline void ajareg_set_acapenable(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00000001u, v << 0); }
+#define ajareg_set_acapenable_small ajareg_set_acapenable
+
+/* Audio Capture Reset (Reg 24, bits 8 to 8) */
+static inline void ajareg_set_acapreset(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00000100u, v << 8); }
+#define ajareg_set_acapreset_small ajareg_set_acapreset
+
+/* Audio Capture Wrap IRQ Clear (depreciated) (Reg 20, bits 26 to 26) */
+static inline void ajareg_set_acapwrapirqclear(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x04000000u, v << 26); }
+#define ajareg_set_acapwrapirqclear_small ajareg_set_acapwrapirqclear
+
+/* Audio Capture Wrap IRQ Enable (depreciated) (Reg 20, bits 5 to 5) */
+static inline void ajareg_set_acapwrapirqenable(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x00000020u, v << 5); }
+#define ajareg_set_acapwrapirqenable_small ajareg_set_acapwrapirqenable
+
+/* Audio Buffer 1/2 Select (Reg 25, bits 0 to 3) */
+static inline void ajareg_set_ain12select(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x64u, 0x0000000Fu, v << 0); }
+#define ajareg_set_ain12select_small ajareg_set_ain12select
+
+/* Audio Buffer 3/4 Select (Reg 25, bits 4 to 7) */
+static inline void ajareg_set_ain34select(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x64u, 0x000000F0u, v << 4); }
+#define ajareg_set_ain34select_small ajareg_set_ain34select
+
+/* Audio Buffer 5/6 Select (Reg 25, bits 8 to 11) */
+static inline void ajareg_set_ain56select(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x64u, 0x00000F00u, v << 8); }
+#define ajareg_set_ain56select_small ajareg_set_ain56select
+
+/* Audio Buffer 7/8 Select (Reg 25, bits 12 to 15) */
+static inline void ajareg_set_ain78select(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x64u, 0x0000F000u, v << 12); }
+#define ajareg_set_ain78select_small ajareg_set_ain78select
+
+/* Audio Mute Ch 1/2 (Reg 24, bits 4 to 4) */
+static inline void ajareg_set_amute12(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00000010u, v << 4); }
+#define ajareg_set_amute12_small ajareg_set_amute12
+
+/* Audio Mute Ch 3/4 (Reg 24, bits 5 to 5) */
+static inline void ajareg_set_amute34(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00000020u, v << 5); }
+#define ajareg_set_amute34_small ajareg_set_amute34
+
+/* Audio Mute Ch 5/6 (Reg 24, bits 6 to 6) */
+static inline void ajareg_set_amute56(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00000040u, v << 6); }
+#define ajareg_set_amute56_small ajareg_set_amute56
+
+/* Audio Mute Ch 7/8 (Reg 24, bits 17 to 17) */
+static inline void ajareg_set_amute78(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00020000u, v << 17); }
+#define ajareg_set_amute78_small ajareg_set_amute78
+
+/* Analog Out - DAC Mode (Reg 128, bits 0 to 4) */
+static inline void ajareg_set_aoutdac(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x200u, 0x0000001Fu, v << 0); }
+static inline void ajareg_set_aoutdac_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Analog Out Crosspoint (Reg 138, bits 0 to 7) */
+static inline void ajareg_set_aoutxpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x228u, 0x000000FFu, v << 0); }
+static inline void ajareg_set_aoutxpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Audio Playback Pause (Reg 24, bits 11 to 11) */
+static inline void ajareg_set_aplaypause(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00000800u, v << 11); }
+#define ajareg_set_aplaypause_small ajareg_set_aplaypause
+
+/* Audio Playback Reset (Reg 24, bits 9 to 9) */
+static inline void ajareg_set_aplayreset(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00000200u, v << 9); }
+#define ajareg_set_aplayreset_small ajareg_set_aplayreset
+
+/* Audio 20bit Output (Reg 24, bits 2 to 2) */
+static inline void ajareg_set_aplaysize(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00000004u, v << 2); }
+#define ajareg_set_aplaysize_small ajareg_set_aplaysize
+
+/* Audio Playback Wrap IRQ Clear (depreciated) (Reg 20, bits 27 to 27) */
+static inline void ajareg_set_aplaywrapirqclear(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x08000000u, v << 27); }
+#define ajareg_set_aplaywrapirqclear_small ajareg_set_aplaywrapirqclear
+
+/* Audio Playback Wrap IRQ Enable (depreciated) (Reg 20, bits 4 to 4) */
+static inline void ajareg_set_aplaywrapirqenable(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x00000010u, v << 4); }
+#define ajareg_set_aplaywrapirqenable_small ajareg_set_aplaywrapirqenable
+
+/* Audio Tone Output Enable (Reg 24, bits 1 to 1) */
+static inline void ajareg_set_atoneoutput(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00000002u, v << 1); }
+#define ajareg_set_atoneoutput_small ajareg_set_atoneoutput
+
+/* Enable 16 channels of audio (Reg 24, bits 20 to 20) */
+static inline void ajareg_set_audio16chan(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00100000u, v << 20); }
+#define ajareg_set_audio16chan_small ajareg_set_audio16chan
+
+/* Enable 8 channels of audio (Reg 24, bits 16 to 16) */
+static inline void ajareg_set_audio8chan(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00010000u, v << 16); }
+#define ajareg_set_audio8chan_small ajareg_set_audio8chan
+
+/* Enable 96KHz audio sample rate (Reg 24, bits 18 to 18) */
+static inline void ajareg_set_audio96khz(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00040000u, v << 18); }
+#define ajareg_set_audio96khz_small ajareg_set_audio96khz
+
+/* Audio Buffer Size (Reg 24, bits 30 to 31) */
+static inline void ajareg_set_audiobigbuffer(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0xC0000000u, v << 30); }
+#define ajareg_set_audiobigbuffer_small ajareg_set_audiobigbuffer
+
+/* Audio 50Hz IRQ Clear (depreciated) (Reg 20, bits 28 to 28) */
+static inline void ajareg_set_audioirqclear(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x10000000u, v << 28); }
+#define ajareg_set_audioirqclear_small ajareg_set_audioirqclear
+
+/* Audio 50Hz IRQ Enable (depreciated) (Reg 20, bits 3 to 3) */
+static inline void ajareg_set_audioirqenable(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x00000008u, v << 3); }
+#define ajareg_set_audioirqenable_small ajareg_set_audioirqenable
+
+/* Audio Loopback Enable (Reg 24, bits 3 to 3) */
+static inline void ajareg_set_audioloopback(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00000008u, v << 3); }
+#define ajareg_set_audioloopback_small ajareg_set_audioloopback
+
+/* Enable raw AES/EBU recording from ch1&2 (Reg 24, bits 19 to 19) */
+static inline void ajareg_set_audioraw(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00080000u, v << 19); }
+#define ajareg_set_audioraw_small ajareg_set_audioraw
+
+/* Audio Wrap IRQ Clear (Reg 20, bits 25 to 25) */
+static inline void ajareg_set_audiowrapirqclear(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x02000000u, v << 25); }
+#define ajareg_set_audiowrapirqclear_small ajareg_set_audiowrapirqclear
+
+/* Audio Wrap IRQ Enable (Reg 20, bits 6 to 6) */
+static inline void ajareg_set_audiowrapirqenable(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x00000040u, v << 6); }
+#define ajareg_set_audiowrapirqenable_small ajareg_set_audiowrapirqenable
+
+/* Clear Bus Error IRQ Error (Reg 49, bits 31 to 31) */
+static inline void ajareg_set_buserrorirqclear(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0xC4u, 0x80000000u, v << 31); }
+#define ajareg_set_buserrorirqclear_small ajareg_set_buserrorirqclear
+
+/* Bus Error IRQ Enable (Reg 49, bits 4 to 4) */
+static inline void ajareg_set_buserrorirqenable(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0xC4u, 0x00000010u, v << 4); }
+#define ajareg_set_buserrorirqenable_small ajareg_set_buserrorirqenable
+
+/* Chan 1 Alpha from Input 2 (Reg 1, bits 5 to 5) */
+static inline void ajareg_set_ch1alphainput2(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x4u, 0x00000020u, v << 5); }
+#define ajareg_set_ch1alphainput2_small ajareg_set_ch1alphainput2
+
+/* Chan 1 Dither Input (Reg 1, bits 16 to 16) */
+static inline void ajareg_set_ch1dither(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x4u, 0x00010000u, v << 16); }
+#define ajareg_set_ch1dither_small ajareg_set_ch1dither
+
+/* DRT Display? (Reg 1, bits 11 to 11) */
+static inline void ajareg_set_ch1drtdisplay(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x4u, 0x00000800u, v << 11); }
+#define ajareg_set_ch1drtdisplay_small ajareg_set_ch1drtdisplay
+
+/* Chan 1 extended format (Reg 1, bits 6 to 6) */
+static inline void ajareg_set_ch1extformat(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x4u, 0x00000040u, v << 6); }
+#define ajareg_set_ch1extformat_small ajareg_set_ch1extformat
+
+/* Chan 1 Flip Vertical (Reg 1, bits 10 to 10) */
+static inline void ajareg_set_ch1flipvert(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x4u, 0x00000400u, v << 10); }
+#define ajareg_set_ch1flipvert_small ajareg_set_ch1flipvert
+
+/* Chan 1 Format (Reg 1, bits 1 to 4) */
+static inline void ajareg_set_ch1format(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x4u, 0x0000001Eu, v << 1); }
+#define ajareg_set_ch1format_small ajareg_set_ch1format
+
+/* Chan 1 Input Frame (Reg 4, bits 0 to 31) */
+static inline void ajareg_set_ch1input(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x10u, v); }
+#define ajareg_set_ch1input_small ajareg_set_ch1input
+
+/* Chan 1 LUT Control (Reg 68, bits 0 to 31) */
+static inline void ajareg_set_ch1lutcont(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x110u, v); }
+static inline void ajareg_set_ch1lutcont_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Chan 1 Mode (Reg 1, bits 0 to 0) */
+static inline void ajareg_set_ch1mode(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x4u, 0x00000001u, v << 0); }
+#define ajareg_set_ch1mode_small ajareg_set_ch1mode
+
+/* Chan 1 Output Frame (Reg 3, bits 0 to 31) */
+static inline void ajareg_set_ch1output(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0xCu, v); }
+#define ajareg_set_ch1output_small ajareg_set_ch1output
+
+/* Chan 1 PCI Frame (Reg 2, bits 0 to 31) */
+static inline void ajareg_set_ch1pciframe(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x8u, v); }
+#define ajareg_set_ch1pciframe_small ajareg_set_ch1pciframe
+
+/* RGB Range (Reg 1, bits 24 to 24) */
+static inline void ajareg_set_ch1rgbrange(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x4u, 0x01000000u, v << 24); }
+#define ajareg_set_ch1rgbrange_small ajareg_set_ch1rgbrange
+
+/* Chan 1 RP188 Bits 0-31 (Reg 30, bits 0 to 31) */
+static inline void ajareg_set_ch1rp188_1(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x78u, v); }
+#define ajareg_set_ch1rp188_1_small ajareg_set_ch1rp188_1
+
+/* Chan 1 RP188 Bits 32-63 (Reg 31, bits 0 to 31) */
+static inline void ajareg_set_ch1rp188_2(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x7Cu, v); }
+#define ajareg_set_ch1rp188_2_small ajareg_set_ch1rp188_2
+
+/* Chan 1 RP188 DBB (Reg 29, bits 0 to 31) */
+static inline void ajareg_set_ch1rp188dbb(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x74u, v); }
+#define ajareg_set_ch1rp188dbb_small ajareg_set_ch1rp188dbb
+
+/* Chan 1 RP188 DBB 1 (Reg 29, bits 0 to 7) */
+static inline void ajareg_set_ch1rp188dbb1(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x74u, 0x000000FFu, v << 0); }
+#define ajareg_set_ch1rp188dbb1_small ajareg_set_ch1rp188dbb1
+
+/* Chan 1 RP188 DBB 2 (Reg 29, bits 8 to 15) */
+static inline void ajareg_set_ch1rp188dbb2(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x74u, 0x0000FF00u, v << 8); }
+#define ajareg_set_ch1rp188dbb2_small ajareg_set_ch1rp188dbb2
+
+/* Chan 1 RP188 filter (Reg 29, bits 24 to 31) */
+static inline void ajareg_set_ch1rp188filter(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x74u, 0xFF000000u, v << 24); }
+#define ajareg_set_ch1rp188filter_small ajareg_set_ch1rp188filter
+
+/* Chan 1 RP-188 Output (Reg 0, bits 28 to 28) */
+static inline void ajareg_set_ch1rp188out(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x0u, 0x10000000u, v << 28); }
+#define ajareg_set_ch1rp188out_small ajareg_set_ch1rp188out
+
+/* Chan 1 Single Field (Reg 1, bits 12 to 12) */
+static inline void ajareg_set_ch1sfield(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x4u, 0x00001000u, v << 12); }
+#define ajareg_set_ch1sfield_small ajareg_set_ch1sfield
+
+/* Chan 1 Horizontal Squeeze (Reg 1, bits 9 to 9) */
+static inline void ajareg_set_ch1squeeze(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x4u, 0x00000200u, v << 9); }
+#define ajareg_set_ch1squeeze_small ajareg_set_ch1squeeze
+
+/* Chan 1 Writeback (Reg 1, bits 8 to 8) */
+static inline void ajareg_set_ch1writeback(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x4u, 0x00000100u, v << 8); }
+#define ajareg_set_ch1writeback_small ajareg_set_ch1writeback
+
+/* Chan 2 Disable (Reg 5, bits 7 to 7) */
+static inline void ajareg_set_ch2disable(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x14u, 0x00000080u, v << 7); }
+#define ajareg_set_ch2disable_small ajareg_set_ch2disable
+
+/* Chan 2 Dither Input (Reg 5, bits 16 to 16) */
+static inline void ajareg_set_ch2dither(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x14u, 0x00010000u, v << 16); }
+#define ajareg_set_ch2dither_small ajareg_set_ch2dither
+
+/* Chan 2 Flip Vertical (Reg 5, bits 10 to 10) */
+static inline void ajareg_set_ch2flipvert(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x14u, 0x00000400u, v << 10); }
+#define ajareg_set_ch2flipvert_small ajareg_set_ch2flipvert
+
+/* Chan 2 Format (Reg 5, bits 1 to 4) */
+static inline void ajareg_set_ch2format(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x14u, 0x0000001Eu, v << 1); }
+#define ajareg_set_ch2format_small ajareg_set_ch2format
+
+/* Chan 2 Input Frame (Reg 8, bits 0 to 31) */
+static inline void ajareg_set_ch2input(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x20u, v); }
+#define ajareg_set_ch2input_small ajareg_set_ch2input
+
+/* Chan 2 Mode (Reg 5, bits 0 to 0) */
+static inline void ajareg_set_ch2mode(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x14u, 0x00000001u, v << 0); }
+#define ajareg_set_ch2mode_small ajareg_set_ch2mode
+
+/* Chan 2 Output Frame (Reg 7, bits 0 to 31) */
+static inline void ajareg_set_ch2output(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x1Cu, v); }
+#define ajareg_set_ch2output_small ajareg_set_ch2output
+
+/* Chan 2 PCI Frame (Reg 6, bits 0 to 31) */
+static inline void ajareg_set_ch2pciframe(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x18u, v); }
+#define ajareg_set_ch2pciframe_small ajareg_set_ch2pciframe
+
+/* Input/Output 2 RP188 low (Reg 65, bits 0 to 31) */
+static inline void ajareg_set_ch2rp188_1(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x104u, v); }
+static inline void ajareg_set_ch2rp188_1_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Input/Output 2 RP188 high (Reg 66, bits 0 to 31) */
+static inline void ajareg_set_ch2rp188_2(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x108u, v); }
+static inline void ajareg_set_ch2rp188_2_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Input/Output 2 RP188 DBB (Reg 64, bits 0 to 31) */
+static inline void ajareg_set_ch2rp188dbb(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x100u, v); }
+static inline void ajareg_set_ch2rp188dbb_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Channel 2 RP188 filter (Reg 64, bits 24 to 31) */
+static inline void ajareg_set_ch2rp188filter(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x100u, 0xFF000000u, v << 24); }
+static inline void ajareg_set_ch2rp188filter_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Chan 2 RP-188 Output (Reg 0, bits 29 to 29) */
+static inline void ajareg_set_ch2rp188out(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x0u, 0x20000000u, v << 29); }
+#define ajareg_set_ch2rp188out_small ajareg_set_ch2rp188out
+
+/* Chan 2 Single Field (Reg 5, bits 12 to 12) */
+static inline void ajareg_set_ch2sfield(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x14u, 0x00001000u, v << 12); }
+#define ajareg_set_ch2sfield_small ajareg_set_ch2sfield
+
+/* Chan 2 Viper Squeeze (Reg 5, bits 9 to 9) */
+static inline void ajareg_set_ch2viper(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x14u, 0x00000200u, v << 9); }
+#define ajareg_set_ch2viper_small ajareg_set_ch2viper
+
+/* Channel 1 Crosspoint (Reg 137, bits 0 to 7) */
+static inline void ajareg_set_chan1xpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x224u, 0x000000FFu, v << 0); }
+static inline void ajareg_set_chan1xpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* FrameBuffer 2 Crosspoint (Reg 140, bits 0 to 7) */
+static inline void ajareg_set_chan2xpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x230u, 0x000000FFu, v << 0); }
+static inline void ajareg_set_chan2xpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Color Correction Bank Select (Reg 0, bits 30 to 31) */
+static inline void ajareg_set_clutbank(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x0u, 0xC0000000u, v << 30); }
+#define ajareg_set_clutbank_small ajareg_set_clutbank
+
+/* Compressor Crosspoint (Reg 136, bits 24 to 31) */
+static inline void ajareg_set_compressxpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x220u, 0xFF000000u, v << 24); }
+static inline void ajareg_set_compressxpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 1 make alpha from key (Reg 142, bits 29 to 29) */
+static inline void ajareg_set_csconv1alphafromkey(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x238u, 0x20000000u, v << 29); }
+static inline void ajareg_set_csconv1alphafromkey_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 1 Custom Coefficient 0 (Reg 142, bits 0 to 10) */
+static inline void ajareg_set_csconv1coef0(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x238u, 0x000007FFu, v << 0); }
+static inline void ajareg_set_csconv1coef0_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 1 Custom Coefficient 1 (Reg 142, bits 16 to 26) */
+static inline void ajareg_set_csconv1coef1(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x238u, 0x07FF0000u, v << 16); }
+static inline void ajareg_set_csconv1coef1_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 1 Custom Coefficient 2 (Reg 143, bits 0 to 10) */
+static inline void ajareg_set_csconv1coef2(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x23Cu, 0x000007FFu, v << 0); }
+static inline void ajareg_set_csconv1coef2_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 1 Custom Coefficient 3 (Reg 143, bits 16 to 26) */
+static inline void ajareg_set_csconv1coef3(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x23Cu, 0x07FF0000u, v << 16); }
+static inline void ajareg_set_csconv1coef3_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 1 Custom Coefficient 4 (Reg 144, bits 0 to 10) */
+static inline void ajareg_set_csconv1coef4(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x240u, 0x000007FFu, v << 0); }
+static inline void ajareg_set_csconv1coef4_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 1 Custom Coefficient 5 (Reg 144, bits 16 to 26) */
+static inline void ajareg_set_csconv1coef5(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x240u, 0x07FF0000u, v << 16); }
+static inline void ajareg_set_csconv1coef5_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 1 Custom Coefficient 6 (Reg 145, bits 0 to 10) */
+static inline void ajareg_set_csconv1coef6(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x244u, 0x000007FFu, v << 0); }
+static inline void ajareg_set_csconv1coef6_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 1 Custom Coefficient 7 (Reg 145, bits 16 to 26) */
+static inline void ajareg_set_csconv1coef7(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x244u, 0x07FF0000u, v << 16); }
+static inline void ajareg_set_csconv1coef7_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 1 Custom Coefficient 8 (Reg 146, bits 0 to 10) */
+static inline void ajareg_set_csconv1coef8(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x248u, 0x000007FFu, v << 0); }
+static inline void ajareg_set_csconv1coef8_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 1 Custom Coefficient 9 (Reg 146, bits 16 to 26) */
+static inline void ajareg_set_csconv1coef9(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x248u, 0x07FF0000u, v << 16); }
+static inline void ajareg_set_csconv1coef9_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 1 use custom coefficents (Reg 142, bits 31 to 31) */
+static inline void ajareg_set_csconv1customcoef(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x238u, 0x80000000u, v << 31); }
+static inline void ajareg_set_csconv1customcoef_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 1 Coefficient (Reg 142, bits 30 to 30) */
+static inline void ajareg_set_csconv1mode(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x238u, 0x40000000u, v << 30); }
+static inline void ajareg_set_csconv1mode_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 1 RGB range (Reg 143, bits 31 to 31) */
+static inline void ajareg_set_csconv1rgbrange(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x23Cu, 0x80000000u, v << 31); }
+static inline void ajareg_set_csconv1rgbrange_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 1 Crosspoint (Reg 136, bits 8 to 15) */
+static inline void ajareg_set_csconv1xpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x220u, 0x0000FF00u, v << 8); }
+static inline void ajareg_set_csconv1xpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 2 make alpha from key (Reg 147, bits 29 to 29) */
+static inline void ajareg_set_csconv2alphafromkey(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x24Cu, 0x20000000u, v << 29); }
+static inline void ajareg_set_csconv2alphafromkey_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 2 Custom Coefficient 0 (Reg 147, bits 0 to 10) */
+static inline void ajareg_set_csconv2coef0(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x24Cu, 0x000007FFu, v << 0); }
+static inline void ajareg_set_csconv2coef0_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 2 Custom Coefficient 1 (Reg 147, bits 16 to 26) */
+static inline void ajareg_set_csconv2coef1(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x24Cu, 0x07FF0000u, v << 16); }
+static inline void ajareg_set_csconv2coef1_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 2 Custom Coefficient 2 (Reg 148, bits 0 to 10) */
+static inline void ajareg_set_csconv2coef2(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x250u, 0x000007FFu, v << 0); }
+static inline void ajareg_set_csconv2coef2_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 2 Custom Coefficient 3 (Reg 148, bits 16 to 26) */
+static inline void ajareg_set_csconv2coef3(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x250u, 0x07FF0000u, v << 16); }
+static inline void ajareg_set_csconv2coef3_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 2 Custom Coefficient 4 (Reg 149, bits 0 to 10) */
+static inline void ajareg_set_csconv2coef4(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x254u, 0x000007FFu, v << 0); }
+static inline void ajareg_set_csconv2coef4_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 2 Custom Coefficient 5 (Reg 149, bits 16 to 26) */
+static inline void ajareg_set_csconv2coef5(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x254u, 0x07FF0000u, v << 16); }
+static inline void ajareg_set_csconv2coef5_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 2 Custom Coefficient 6 (Reg 150, bits 0 to 10) */
+static inline void ajareg_set_csconv2coef6(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x258u, 0x000007FFu, v << 0); }
+static inline void ajareg_set_csconv2coef6_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 2 Custom Coefficient 7 (Reg 150, bits 16 to 26) */
+static inline void ajareg_set_csconv2coef7(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x258u, 0x07FF0000u, v << 16); }
+static inline void ajareg_set_csconv2coef7_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 2 Custom Coefficient 8 (Reg 151, bits 0 to 10) */
+static inline void ajareg_set_csconv2coef8(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x25Cu, 0x000007FFu, v << 0); }
+static inline void ajareg_set_csconv2coef8_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 2 Custom Coefficient 9 (Reg 151, bits 16 to 26) */
+static inline void ajareg_set_csconv2coef9(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x25Cu, 0x07FF0000u, v << 16); }
+static inline void ajareg_set_csconv2coef9_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 2 use custom coefficents (Reg 147, bits 31 to 31) */
+static inline void ajareg_set_csconv2customcoef(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x24Cu, 0x80000000u, v << 31); }
+static inline void ajareg_set_csconv2customcoef_small(AJA_REGCTX c, uint32_t v) { }
+
+/* ColorSpace Converter 2 Key Crosspoint (Reg 140, bits 24 to 31) */
+static inline void ajareg_set_csconv2keyxpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x230u, 0xFF000000u, v << 24); }
+static inline void ajareg_set_csconv2keyxpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 2 Coefficient (Reg 147, bits 30 to 30) */
+static inline void ajareg_set_csconv2mode(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x24Cu, 0x40000000u, v << 30); }
+static inline void ajareg_set_csconv2mode_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 2 RGB range (Reg 148, bits 31 to 31) */
+static inline void ajareg_set_csconv2rgbrange(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x250u, 0x80000000u, v << 31); }
+static inline void ajareg_set_csconv2rgbrange_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 2 Crosspoint (Reg 140, bits 16 to 23) */
+static inline void ajareg_set_csconv2xpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x230u, 0x00FF0000u, v << 16); }
+static inline void ajareg_set_csconv2xpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* ColorSpace Converter Key Crosspoint (Reg 138, bits 24 to 31) */
+static inline void ajareg_set_csconvkeyxpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x228u, 0xFF000000u, v << 24); }
+static inline void ajareg_set_csconvkeyxpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Colorspace Converter 1 Crosspoint (Reg 136, bits 8 to 15) */
+static inline void ajareg_set_csconvxpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x220u, 0x0000FF00u, v << 8); }
+static inline void ajareg_set_csconvxpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Enable Dual Link Input (Reg 0, bits 23 to 23) */
+static inline void ajareg_set_dlinput(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x0u, 0x00800000u, v << 23); }
+#define ajareg_set_dlinput_small ajareg_set_dlinput
+
+/* Enable Dual Link Output (Reg 0, bits 27 to 27) */
+static inline void ajareg_set_dloutput(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x0u, 0x08000000u, v << 27); }
+#define ajareg_set_dloutput_small ajareg_set_dloutput
+
+/* Dual-Link Output Crosspoint (Reg 137, bits 24 to 31) */
+static inline void ajareg_set_dloutxpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x224u, 0xFF000000u, v << 24); }
+static inline void ajareg_set_dloutxpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* DMA 1 Card Address (Reg 33, bits 0 to 29) */
+static inline void ajareg_set_dma1cadd(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x84u, 0x3FFFFFFFu, v << 0); }
+#define ajareg_set_dma1cadd_small ajareg_set_dma1cadd
+
+/* DMA 1 Word Count (Reg 34, bits 0 to 31) */
+static inline void ajareg_set_dma1count(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x88u, v); }
+#define ajareg_set_dma1count_small ajareg_set_dma1count
+
+/* DMA 1 GO (Reg 48, bits 0 to 0) */
+static inline void ajareg_set_dma1go(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0xC0u, 0x00000001u, v << 0); }
+#define ajareg_set_dma1go_small ajareg_set_dma1go
+
+/* DMA 1 Host Address (Reg 32, bits 0 to 31) */
+static inline void ajareg_set_dma1hadd(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x80u, v); }
+#define ajareg_set_dma1hadd_small ajareg_set_dma1hadd
+
+/* DMA 1 Host Address (MSB 32) (Reg 100, bits 0 to 31) */
+static inline void ajareg_set_dma1hadd_high(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x190u, v); }
+static inline void ajareg_set_dma1hadd_high_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Clear DMA 1 IRQ (Reg 49, bits 27 to 27) */
+static inline void ajareg_set_dma1irqclear(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0xC4u, 0x08000000u, v << 27); }
+#define ajareg_set_dma1irqclear_small ajareg_set_dma1irqclear
+
+/* DMA 1 IRQ Enable (Reg 49, bits 0 to 0) */
+static inline void ajareg_set_dma1irqenable(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0xC4u, 0x00000001u, v << 0); }
+#define ajareg_set_dma1irqenable_small ajareg_set_dma1irqenable
+
+/* DMA 1 Next Descriptor (Reg 35, bits 0 to 31) */
+static inline void ajareg_set_dma1next(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x8Cu, v); }
+#define ajareg_set_dma1next_small ajareg_set_dma1next
+
+/* DMA 1 Next Descriptor Address (MSB 32) (Reg 101, bits 0 to 31) */
+static inline void ajareg_set_dma1next_high(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x194u, v); }
+static inline void ajareg_set_dma1next_high_small(AJA_REGCTX c, uint32_t v) { }
+
+/* DMA 2 Card Address (Reg 37, bits 0 to 31) */
+static inline void ajareg_set_dma2cadd(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x94u, v); }
+#define ajareg_set_dma2cadd_small ajareg_set_dma2cadd
+
+/* DMA 2 Word Count (Reg 38, bits 0 to 31) */
+static inline void ajareg_set_dma2count(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x98u, v); }
+#define ajareg_set_dma2count_small ajareg_set_dma2count
+
+/* DMA 2 GO (Reg 48, bits 1 to 1) */
+static inline void ajareg_set_dma2go(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0xC0u, 0x00000002u, v << 1); }
+#define ajareg_set_dma2go_small ajareg_set_dma2go
+
+/* DMA 2 Host Address (Reg 36, bits 0 to 31) */
+static inline void ajareg_set_dma2hadd(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x90u, v); }
+#define ajareg_set_dma2hadd_small ajareg_set_dma2hadd
+
+/* DMA 1 Host Address (MSB 32) (Reg 102, bits 0 to 31) */
+static inline void ajareg_set_dma2hadd_high(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x198u, v); }
+static inline void ajareg_set_dma2hadd_high_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Clear DMA 2 IRQ (Reg 49, bits 28 to 28) */
+static inline void ajareg_set_dma2irqclear(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0xC4u, 0x10000000u, v << 28); }
+#define ajareg_set_dma2irqclear_small ajareg_set_dma2irqclear
+
+/* DMA 2 IRQ Enable (Reg 49, bits 1 to 1) */
+static inline void ajareg_set_dma2irqenable(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0xC4u, 0x00000002u, v << 1); }
+#define ajareg_set_dma2irqenable_small ajareg_set_dma2irqenable
+
+/* DMA 2 Next Descriptor (Reg 39, bits 0 to 31) */
+static inline void ajareg_set_dma2next(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x9Cu, v); }
+#define ajareg_set_dma2next_small ajareg_set_dma2next
+
+/* DMA 1 Next Descriptor Address (MSB 32) (Reg 103, bits 0 to 31) */
+static inline void ajareg_set_dma2next_high(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x19Cu, v); }
+static inline void ajareg_set_dma2next_high_small(AJA_REGCTX c, uint32_t v) { }
+
+/* DMA 3 Card Address (Reg 41, bits 0 to 31) */
+static inline void ajareg_set_dma3cadd(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0xA4u, v); }
+#define ajareg_set_dma3cadd_small ajareg_set_dma3cadd
+
+/* DMA 3 Word Count (Reg 42, bits 0 to 31) */
+static inline void ajareg_set_dma3count(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0xA8u, v); }
+#define ajareg_set_dma3count_small ajareg_set_dma3count
+
+/* DMA 3 GO (Reg 48, bits 2 to 2) */
+static inline void ajareg_set_dma3go(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0xC0u, 0x00000004u, v << 2); }
+#define ajareg_set_dma3go_small ajareg_set_dma3go
+
+/* DMA 3 Host Address (Reg 40, bits 0 to 31) */
+static inline void ajareg_set_dma3hadd(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0xA0u, v); }
+#define ajareg_set_dma3hadd_small ajareg_set_dma3hadd
+
+/* DMA 1 Host Address (MSB 32) (Reg 104, bits 0 to 31) */
+static inline void ajareg_set_dma3hadd_high(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x1A0u, v); }
+static inline void ajareg_set_dma3hadd_high_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Clear DMA 3 IRQ (Reg 49, bits 29 to 29) */
+static inline void ajareg_set_dma3irqclear(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0xC4u, 0x20000000u, v << 29); }
+#define ajareg_set_dma3irqclear_small ajareg_set_dma3irqclear
+
+/* DMA 3 IRQ Enable (Reg 49, bits 2 to 2) */
+static inline void ajareg_set_dma3irqenable(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0xC4u, 0x00000004u, v << 2); }
+#define ajareg_set_dma3irqenable_small ajareg_set_dma3irqenable
+
+/* DMA 3 Next Descriptor (Reg 43, bits 0 to 31) */
+static inline void ajareg_set_dma3next(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0xACu, v); }
+#define ajareg_set_dma3next_small ajareg_set_dma3next
+
+/* DMA 1 Next Descriptor Address (MSB 32) (Reg 105, bits 0 to 31) */
+static inline void ajareg_set_dma3next_high(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x1A4u, v); }
+static inline void ajareg_set_dma3next_high_small(AJA_REGCTX c, uint32_t v) { }
+
+/* DMA 4 GO (Reg 48, bits 3 to 3) */
+static inline void ajareg_set_dma4go(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0xC0u, 0x00000008u, v << 3); }
+#define ajareg_set_dma4go_small ajareg_set_dma4go
+
+/* DMA 1 Host Address (MSB 32) (Reg 106, bits 0 to 31) */
+static inline void ajareg_set_dma4hadd_high(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x1A8u, v); }
+static inline void ajareg_set_dma4hadd_high_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Clear DMA 4 IRQ (Reg 49, bits 30 to 30) */
+static inline void ajareg_set_dma4irqclear(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0xC4u, 0x40000000u, v << 30); }
+#define ajareg_set_dma4irqclear_small ajareg_set_dma4irqclear
+
+/* DMA 4 IRQ Enable (Reg 49, bits 3 to 3) */
+static inline void ajareg_set_dma4irqenable(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0xC4u, 0x00000008u, v << 3); }
+#define ajareg_set_dma4irqenable_small ajareg_set_dma4irqenable
+
+/* DMA 1 Next Descriptor Address (MSB 32) (Reg 107, bits 0 to 31) */
+static inline void ajareg_set_dma4next_high(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x1ACu, v); }
+static inline void ajareg_set_dma4next_high_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Downconversion Mode (Reg 131, bits 4 to 5) */
+static inline void ajareg_set_downconvmode(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x20Cu, 0x00000030u, v << 4); }
+static inline void ajareg_set_downconvmode_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Output 1 Embedded Audio Supress (Reg 24, bits 13 to 13) */
+static inline void ajareg_set_eaud1supress(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00002000u, v << 13); }
+#define ajareg_set_eaud1supress_small ajareg_set_eaud1supress
+
+/* Output 2 Embedded Audio Supress (Reg 24, bits 15 to 15) */
+static inline void ajareg_set_eaud2supress(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x00008000u, v << 15); }
+#define ajareg_set_eaud2supress_small ajareg_set_eaud2supress
+
+/* Embedded Audio Input Select (Reg 25, bits 16 to 16) */
+static inline void ajareg_set_eaudselect(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x64u, 0x00010000u, v << 16); }
+#define ajareg_set_eaudselect_small ajareg_set_eaudselect
+
+/* Force card to use 64bit PCI (Reg 48, bits 4 to 4) */
+static inline void ajareg_set_force64bit(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0xC0u, 0x00000010u, v << 4); }
+#define ajareg_set_force64bit_small ajareg_set_force64bit
+
+/* Frame Geometry (Reg 0, bits 3 to 6) */
+static inline void ajareg_set_framegeo(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x0u, 0x00000078u, v << 3); }
+#define ajareg_set_framegeo_small ajareg_set_framegeo
+
+/* Frame Rate (Reg 0, bits 0 to 2) */
+static inline void ajareg_set_framerate(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x0u, 0x00000007u, v << 0); }
+#define ajareg_set_framerate_small ajareg_set_framerate
+
+/* Extra bit for 2k framerates (Reg 0, bits 22 to 22) */
+static inline void ajareg_set_framerate2k(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x0u, 0x00400000u, v << 22); }
+#define ajareg_set_framerate2k_small ajareg_set_framerate2k
+
+/* Horizontal Timing (Reg 14, bits 0 to 15) */
+static inline void ajareg_set_horiztiming(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x38u, 0x0000FFFFu, v << 0); }
+#define ajareg_set_horiztiming_small ajareg_set_horiztiming
+
+/* Input Converter Standard (Reg 131, bits 0 to 2) */
+static inline void ajareg_set_inconvstd(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x20Cu, 0x00000007u, v << 0); }
+static inline void ajareg_set_inconvstd_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Input 1 IRQ Clear (Reg 20, bits 30 to 30) */
+static inline void ajareg_set_input1irqclear(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x40000000u, v << 30); }
+#define ajareg_set_input1irqclear_small ajareg_set_input1irqclear
+
+/* Input1 IRQ Enable (Reg 20, bits 1 to 1) */
+static inline void ajareg_set_input1irqenable(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x00000002u, v << 1); }
+#define ajareg_set_input1irqenable_small ajareg_set_input1irqenable
+
+/* Input 2 IRQ Clear (Reg 20, bits 29 to 29) */
+static inline void ajareg_set_input2irqclear(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x20000000u, v << 29); }
+#define ajareg_set_input2irqclear_small ajareg_set_input2irqclear
+
+/* Input2 IRQ Enable (Reg 20, bits 2 to 2) */
+static inline void ajareg_set_input2irqenable(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x00000004u, v << 2); }
+#define ajareg_set_input2irqenable_small ajareg_set_input2irqenable
+
+/* KBOX Input Selection (Reg 24, bits 26 to 26) */
+static inline void ajareg_set_kboxinput(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x04000000u, v << 26); }
+#define ajareg_set_kboxinput_small ajareg_set_kboxinput
+
+/* KBOX Audio Monitor Output (Reg 24, bits 24 to 25) */
+static inline void ajareg_set_kboxmonitor(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x60u, 0x03000000u, v << 24); }
+#define ajareg_set_kboxmonitor_small ajareg_set_kboxmonitor
+
+/* Card LEDs (Reg 0, bits 16 to 19) */
+static inline void ajareg_set_leds(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x0u, 0x000F0000u, v << 16); }
+#define ajareg_set_leds_small ajareg_set_leds
+
+/* LUT 1 Crosspoint (Reg 136, bits 0 to 7) */
+static inline void ajareg_set_lut1xpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x220u, 0x000000FFu, v << 0); }
+static inline void ajareg_set_lut1xpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* LUT 2 Crosspoint (Reg 140, bits 8 to 15) */
+static inline void ajareg_set_lut2xpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x230u, 0x0000FF00u, v << 8); }
+static inline void ajareg_set_lut2xpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Matte Cb Value (Reg 13, bits 0 to 9) */
+static inline void ajareg_set_mattecb(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x34u, 0x000003FFu, v << 0); }
+#define ajareg_set_mattecb_small ajareg_set_mattecb
+
+/* Matte Cr Value (Reg 13, bits 20 to 29) */
+static inline void ajareg_set_mattecr(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x34u, 0x3FF00000u, v << 20); }
+#define ajareg_set_mattecr_small ajareg_set_mattecr
+
+/* Matte Y Value (Reg 13, bits 10 to 19) */
+static inline void ajareg_set_mattey(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x34u, 0x000FFC00u, v << 10); }
+#define ajareg_set_mattey_small ajareg_set_mattey
+
+/* Mixer Background Key Crosspoint (Reg 139, bits 24 to 31) */
+static inline void ajareg_set_mixbgkeyxpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x22Cu, 0xFF000000u, v << 24); }
+static inline void ajareg_set_mixbgkeyxpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Mixer Background Video Crosspoint (Reg 139, bits 16 to 23) */
+static inline void ajareg_set_mixbgvidxpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x22Cu, 0x00FF0000u, v << 16); }
+static inline void ajareg_set_mixbgvidxpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Mixer Value (Reg 11, bits 0 to 31) */
+static inline void ajareg_set_mixer(AJA_REGCTX c, uint32_t v) { AJA_REGWRITE(c, 0x2Cu, v); }
+#define ajareg_set_mixer_small ajareg_set_mixer
+
+/* Mixer Foreground Key Crosspoint (Reg 139, bits 8 to 15) */
+static inline void ajareg_set_mixfgkeyxpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x22Cu, 0x0000FF00u, v << 8); }
+static inline void ajareg_set_mixfgkeyxpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Mixer Foreground Video Crosspoint (Reg 139, bits 0 to 7) */
+static inline void ajareg_set_mixfgvidxpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x22Cu, 0x000000FFu, v << 0); }
+static inline void ajareg_set_mixfgvidxpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Output Converter Standard (Reg 131, bits 12 to 14) */
+static inline void ajareg_set_outconvstd(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x20Cu, 0x00007000u, v << 12); }
+static inline void ajareg_set_outconvstd_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Output IRQ Clear (Reg 20, bits 31 to 31) */
+static inline void ajareg_set_outputirqclear(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x80000000u, v << 31); }
+#define ajareg_set_outputirqclear_small ajareg_set_outputirqclear
+
+/* Output IRQ Enable (Reg 20, bits 0 to 0) */
+static inline void ajareg_set_outputirqenable(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x00000001u, v << 0); }
+#define ajareg_set_outputirqenable_small ajareg_set_outputirqenable
+
+/* Pan Horizontal Offset (Reg 15, bits 0 to 11) */
+static inline void ajareg_set_panhoriz(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x3Cu, 0x00000FFFu, v << 0); }
+#define ajareg_set_panhoriz_small ajareg_set_panhoriz
+
+/* Pan Vertical Offset (Reg 15, bits 12 to 23) */
+static inline void ajareg_set_panvert(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x3Cu, 0x00FFF000u, v << 12); }
+#define ajareg_set_panvert_small ajareg_set_panvert
+
+/* Pan window size (Reg 15, bits 30 to 31) */
+static inline void ajareg_set_panwindow(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x3Cu, 0xC0000000u, v << 30); }
+#define ajareg_set_panwindow_small ajareg_set_panwindow
+
+/* Reference Source (Reg 0, bits 10 to 11) */
+static inline void ajareg_set_refsource(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x0u, 0x00000C00u, v << 10); }
+#define ajareg_set_refsource_small ajareg_set_refsource
+
+/* Reference Voltage (Reg 0, bits 12 to 12) */
+static inline void ajareg_set_refvoltage(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x0u, 0x00001000u, v << 12); }
+#define ajareg_set_refvoltage_small ajareg_set_refvoltage
+
+/* Register Clocking (Reg 0, bits 20 to 21) */
+static inline void ajareg_set_regclocking(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x0u, 0x00300000u, v << 20); }
+#define ajareg_set_regclocking_small ajareg_set_regclocking
+
+/* Resolution converter add 2:3 (Reg 131, bits 6 to 6) */
+static inline void ajareg_set_resconv23(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x20Cu, 0x00000040u, v << 6); }
+static inline void ajareg_set_resconv23_small(AJA_REGCTX c, uint32_t v) { }
+
+/* SD Anamorphic Conversion Mode (Reg 131, bits 20 to 21) */
+static inline void ajareg_set_resconvsdanim(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x20Cu, 0x00300000u, v << 20); }
+static inline void ajareg_set_resconvsdanim_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Up/Down Converter Crosspoint (Reg 136, bits 16 to 23) */
+static inline void ajareg_set_resconvxpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x220u, 0x00FF0000u, v << 16); }
+static inline void ajareg_set_resconvxpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* SDI 1 Output 2048x1080 mode (Reg 129, bits 3 to 3) */
+static inline void ajareg_set_sdi1out2kline(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x204u, 0x00000008u, v << 3); }
+static inline void ajareg_set_sdi1out2kline_small(AJA_REGCTX c, uint32_t v) { }
+
+/* SDI 1 Output HBlank RGB range (Reg 129, bits 7 to 7) */
+static inline void ajareg_set_sdi1outhblankrgb(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x204u, 0x00000080u, v << 7); }
+static inline void ajareg_set_sdi1outhblankrgb_small(AJA_REGCTX c, uint32_t v) { }
+
+/* SDI 1 Output Standard (Reg 129, bits 0 to 2) */
+static inline void ajareg_set_sdi1outstd(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x204u, 0x00000007u, v << 0); }
+static inline void ajareg_set_sdi1outstd_small(AJA_REGCTX c, uint32_t v) { }
+
+/* SDI 1 Output Crosspoint (Reg 138, bits 8 to 15) */
+static inline void ajareg_set_sdi1outxpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x228u, 0x0000FF00u, v << 8); }
+static inline void ajareg_set_sdi1outxpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* SDI 2 Output 2048x1080 mode (Reg 130, bits 3 to 3) */
+static inline void ajareg_set_sdi2out2kline(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x208u, 0x00000008u, v << 3); }
+static inline void ajareg_set_sdi2out2kline_small(AJA_REGCTX c, uint32_t v) { }
+
+/* SDI 2 Output HBlank RGB range (Reg 130, bits 7 to 7) */
+static inline void ajareg_set_sdi2outhblankrgb(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x208u, 0x00000080u, v << 7); }
+static inline void ajareg_set_sdi2outhblankrgb_small(AJA_REGCTX c, uint32_t v) { }
+
+/* SDI 2 Output Standard (Reg 130, bits 0 to 2) */
+static inline void ajareg_set_sdi2outstd(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x208u, 0x00000007u, v << 0); }
+static inline void ajareg_set_sdi2outstd_small(AJA_REGCTX c, uint32_t v) { }
+
+/* SDI 2 Output Crosspoint (Reg 138, bits 16 to 23) */
+static inline void ajareg_set_sdi2outxpt(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x228u, 0x00FF0000u, v << 16); }
+static inline void ajareg_set_sdi2outxpt_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Split Screen Slope (Reg 12, bits 16 to 29) */
+static inline void ajareg_set_splitslope(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x30u, 0x3FFF0000u, v << 16); }
+#define ajareg_set_splitslope_small ajareg_set_splitslope
+
+/* Split Screen Start (Reg 12, bits 0 to 15) */
+static inline void ajareg_set_splitstart(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x30u, 0x0000FFFFu, v << 0); }
+#define ajareg_set_splitstart_small ajareg_set_splitstart
+
+/* Split Screen Type (Reg 12, bits 30 to 31) */
+static inline void ajareg_set_splittype(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x30u, 0xC0000000u, v << 30); }
+#define ajareg_set_splittype_small ajareg_set_splittype
+
+/* Video Standard (Reg 0, bits 7 to 9) */
+static inline void ajareg_set_standard(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x0u, 0x00000380u, v << 7); }
+#define ajareg_set_standard_small ajareg_set_standard
+
+/* Strap Resistor Enabled (Reg 48, bits 7 to 7) */
+static inline void ajareg_set_strapenabled(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0xC0u, 0x00000080u, v << 7); }
+#define ajareg_set_strapenabled_small ajareg_set_strapenabled
+
+/* UART recieve enable (Reg 72, bits 3 to 3) */
+static inline void ajareg_set_uartenablerx(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x120u, 0x00000008u, v << 3); }
+static inline void ajareg_set_uartenablerx_small(AJA_REGCTX c, uint32_t v) { }
+
+/* UART transmit enable (Reg 72, bits 0 to 0) */
+static inline void ajareg_set_uartenabletx(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x120u, 0x00000001u, v << 0); }
+static inline void ajareg_set_uartenabletx_small(AJA_REGCTX c, uint32_t v) { }
+
+/* UART transmit data (Reg 70, bits 0 to 7) */
+static inline void ajareg_set_uartout(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x118u, 0x000000FFu, v << 0); }
+static inline void ajareg_set_uartout_small(AJA_REGCTX c, uint32_t v) { }
+
+/* UART Rx IRQ Clear (Reg 20, bits 15 to 15) */
+static inline void ajareg_set_uartrxirqclear(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x00008000u, v << 15); }
+#define ajareg_set_uartrxirqclear_small ajareg_set_uartrxirqclear
+
+/* UART Rx IRQ Enable (Reg 20, bits 8 to 8) */
+static inline void ajareg_set_uartrxirqenable(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x00000100u, v << 8); }
+#define ajareg_set_uartrxirqenable_small ajareg_set_uartrxirqenable
+
+/* UART rx fifo overrun (Reg 72, bits 7 to 7) */
+static inline void ajareg_set_uartrxoverrun(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x120u, 0x00000080u, v << 7); }
+static inline void ajareg_set_uartrxoverrun_small(AJA_REGCTX c, uint32_t v) { }
+
+/* UART rx parity error (Reg 72, bits 6 to 6) */
+static inline void ajareg_set_uartrxparityerror(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x120u, 0x00000040u, v << 6); }
+static inline void ajareg_set_uartrxparityerror_small(AJA_REGCTX c, uint32_t v) { }
+
+/* UART recieve status (Reg 72, bits 4 to 7) */
+static inline void ajareg_set_uartstatusrx(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x120u, 0x000000F0u, v << 4); }
+static inline void ajareg_set_uartstatusrx_small(AJA_REGCTX c, uint32_t v) { }
+
+/* UART Tx IRQ Clear (Reg 20, bits 24 to 24) */
+static inline void ajareg_set_uarttxirqclear(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x01000000u, v << 24); }
+#define ajareg_set_uarttxirqclear_small ajareg_set_uarttxirqclear
+
+/* UART Tx IRQ Enable (Reg 20, bits 7 to 7) */
+static inline void ajareg_set_uarttxirqenable(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x50u, 0x00000080u, v << 7); }
+#define ajareg_set_uarttxirqenable_small ajareg_set_uarttxirqenable
+
+/* Upconversion Mode (Reg 131, bits 8 to 10) */
+static inline void ajareg_set_upconvmode(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x20Cu, 0x00000700u, v << 8); }
+static inline void ajareg_set_upconvmode_small(AJA_REGCTX c, uint32_t v) { }
+
+/* Vertical Timing (Reg 14, bits 16 to 31) */
+static inline void ajareg_set_verttiming(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x38u, 0xFFFF0000u, v << 16); }
+#define ajareg_set_verttiming_small ajareg_set_verttiming
+
+/* Video Firmware Data (Reg 17, bits 0 to 7) */
+static inline void ajareg_set_vidfw_data(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x44u, 0x000000FFu, v << 0); }
+#define ajareg_set_vidfw_data_small ajareg_set_vidfw_data
+
+/* Video Firmware Programming PCI-X programming mode (Reg 17, bits 29 to 29) */
+static inline void ajareg_set_vidfw_pcix(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x44u, 0x20000000u, v << 29); }
+#define ajareg_set_vidfw_pcix_small ajareg_set_vidfw_pcix
+
+/* Video Firmware Program (Reg 17, bits 8 to 8) */
+static inline void ajareg_set_vidfw_program(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x44u, 0x00000100u, v << 8); }
+#define ajareg_set_vidfw_program_small ajareg_set_vidfw_program
+
+/* Video Firmware Reset (Reg 17, bits 10 to 10) */
+static inline void ajareg_set_vidfw_reset(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x44u, 0x00000400u, v << 10); }
+#define ajareg_set_vidfw_reset_small ajareg_set_vidfw_reset
+
+/* Video Processing Control - Background Control (Reg 9, bits 22 to 23) */
+static inline void ajareg_set_vpc_bgcont(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x24u, 0x00C00000u, v << 22); }
+#define ajareg_set_vpc_bgcont_small ajareg_set_vpc_bgcont
+
+/* Video Processing Control - Foreground Control (Reg 9, bits 20 to 21) */
+static inline void ajareg_set_vpc_fgcont(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x24u, 0x00300000u, v << 20); }
+#define ajareg_set_vpc_fgcont_small ajareg_set_vpc_fgcont
+
+/* Video Processing Control - Limiting (Reg 9, bits 11 to 12) */
+static inline void ajareg_set_vpc_limiting(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x24u, 0x00001800u, v << 11); }
+#define ajareg_set_vpc_limiting_small ajareg_set_vpc_limiting
+
+/* Video Processing Control - Mode (Reg 9, bits 24 to 25) */
+static inline void ajareg_set_vpc_mode(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x24u, 0x03000000u, v << 24); }
+#define ajareg_set_vpc_mode_small ajareg_set_vpc_mode
+
+/* Video Processing Control - Mux1 (Reg 9, bits 0 to 1) */
+static inline void ajareg_set_vpc_mux1(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x24u, 0x00000003u, v << 0); }
+#define ajareg_set_vpc_mux1_small ajareg_set_vpc_mux1
+
+/* Video Processing Control - Mux2 (Reg 9, bits 2 to 3) */
+static inline void ajareg_set_vpc_mux2(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x24u, 0x0000000Cu, v << 2); }
+#define ajareg_set_vpc_mux2_small ajareg_set_vpc_mux2
+
+/* Video Processint Control - Mux3 (Reg 9, bits 4 to 5) */
+static inline void ajareg_set_vpc_mux3(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x24u, 0x00000030u, v << 4); }
+#define ajareg_set_vpc_mux3_small ajareg_set_vpc_mux3
+
+/* Video Processing Control - Mux4 (Reg 9, bits 6 to 7) */
+static inline void ajareg_set_vpc_mux4(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x24u, 0x000000C0u, v << 6); }
+#define ajareg_set_vpc_mux4_small ajareg_set_vpc_mux4
+
+/* Video Processing Control - Mux5 (Reg 9, bits 8 to 10) */
+static inline void ajareg_set_vpc_mux5(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x24u, 0x00000700u, v << 8); }
+#define ajareg_set_vpc_mux5_small ajareg_set_vpc_mux5
+
+/* Video Processing Control - Standard (Reg 9, bits 28 to 30) */
+static inline void ajareg_set_vpc_standard(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x24u, 0x70000000u, v << 28); }
+#define ajareg_set_vpc_standard_small ajareg_set_vpc_standard
+
+/* Video Processing Crosspoint - Background Key (Reg 10, bits 12 to 14) */
+static inline void ajareg_set_vpcc_bgkey(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x28u, 0x00007000u, v << 12); }
+#define ajareg_set_vpcc_bgkey_small ajareg_set_vpcc_bgkey
+
+/* Video Processing Crosspoint - Background Video (Reg 10, bits 4 to 6) */
+static inline void ajareg_set_vpcc_bgv(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x28u, 0x00000070u, v << 4); }
+#define ajareg_set_vpcc_bgv_small ajareg_set_vpcc_bgv
+
+/* Video Processing Crosspoint - Foreground Key (Reg 10, bits 8 to 10) */
+static inline void ajareg_set_vpcc_fgkey(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x28u, 0x00000700u, v << 8); }
+#define ajareg_set_vpcc_fgkey_small ajareg_set_vpcc_fgkey
+
+/* Video Processing Crosspoint - Foreground Video (Reg 10, bits 0 to 2) */
+static inline void ajareg_set_vpcc_fgv(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x28u, 0x00000007u, v << 0); }
+#define ajareg_set_vpcc_fgv_small ajareg_set_vpcc_fgv
+
+/* Video Processing Crosspoint - Secondary Video (Reg 10, bits 16 to 18) */
+static inline void ajareg_set_vpcc_secv(AJA_REGCTX c, uint32_t v) { AJA_REGUPDATE(c, 0x28u, 0x00070000u, v << 16); }
+#define ajareg_set_vpcc_secv_small ajareg_set_vpcc_secv
+
+#endif /* AJA_REGWRITE */
+
+#endif /* _AJA_REGACCESS_H_ defined */
+
@@ -1047,6 +1047,10 @@ const aja_register_t ajareg_dma4irqenable = {0xC4u, 3u, 0x00000008u};
 const aja_register_t ajareg_dma4next_high = {0x1ACu, 0u, 0xFFFFFFFFu};
 
 
+/* DMA Status (whole register) (Reg 48, bits 0 to 31) [Read Only] */
+const aja_register_t ajareg_dmastatus = {0xC0u, 0u, 0xFFFFFFFFu};
+
+
 /* Downconversion Mode (Reg 131, bits 4 to 5) [Read/Write] */
 /* __ Settings __
  * 2: anamorphic
@@ -1291,6 +1295,10 @@ const aja_register_t ajareg_input2prog = {0x58u, 15u, 0x00008000u};
 const aja_register_t ajareg_input2vblank = {0x54u, 18u, 0x00040000u};
 
 
+/* IRQ Status (whole register) (Reg 21, bits 0 to 31) [Read Only] */
+const aja_register_t ajareg_irqstatus = {0x54u, 0u, 0xFFFFFFFFu};
+
+
 /* KBOX Input Selection (Reg 24, bits 26 to 26) [Read/Write] */
 /* __ Settings __
  * 0: bnc
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * aja_regmap.h
+ *
+ * Creation Date: October 19, 2026
+ * Author(s):
+ *
+ *
+ * Copyright (c) 2026, SpectSoft
+ *   All Rights Reserved.
+ *   http://www.spectsoft.com/
+ *   info@spectsoft.com
+ *
+ * $Id$
+ *
+ * DESC: Userspace register status reads over the mmap'ed card registers (BAR 0).
+ *       Reads never make a syscall.  The mapping is read only, all writes still
+ *       go through the driver (aja_setregister, aja_registerv) so they get the
+ *       register lock and shadow.
+ *
+ ******************************************************************************/
+#ifndef _AJA_REGMAP_H_
+#define _AJA_REGMAP_H_
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <aja_userspace.h>
+#include <aja_regaccess.h>
+
+typedef struct {
+	volatile uint32_t 	*regs;		/* Mapped register space */
+	size_t 			len;		/* Length of the mapping */
+	uint32_t 		flags;		/* Board flags (aja_board_flags) */
+} aja_regmap_t;
+
+/* A snapshot of the commonly polled status fields.  Each register is read once
+ * and the fields are decoded from that, so fields in the same register agree */
+typedef struct {
+	uint32_t 		outputline;		/* Output line number */
+	uint32_t 		outputfield;		/* Output field */
+	uint32_t 		audiocount;		/* 48KHz audio counter */
+	uint32_t 		acaplast;		/* Audio capture last address */
+	uint32_t 		aplaylast;		/* Audio playback last address */
+	uint32_t 		framerate;		/* Output frame rate */
+	uint32_t 		framegeo;		/* Output frame geometry */
+	uint32_t 		standard;		/* Output standard */
+	uint32_t 		input1framerate;	/* Input 1 frame rate */
+	uint32_t 		input1format;		/* Input 1 format */
+	uint32_t 		input1prog;		/* Input 1 progressive */
+	uint32_t 		input2framerate;	/* Input 2 frame rate */
+	uint32_t 		input2format;		/* Input 2 format */
+	uint32_t 		input2prog;		/* Input 2 progressive */
+	uint32_t 		fpgaversion;		/* FPGA version */
+	uint32_t 		boardversion;		/* Board version */
+} aja_regmap_status_t;
+
+/* Maps the card registers of an open card device.  Returns 0 on success */
+static inline int aja_regmap_open(aja_regmap_t *map, int fd) {
+	void *p;
+	aja_boardinfo_t info = aja_getboardinfo(fd);
+	map->flags = info.flags;
+	map->len = getpagesize();
+	p = mmap(NULL, map->len, PROT_READ, MAP_SHARED, fd, 0);
+	if(p == MAP_FAILED) {
+		map->regs = NULL;
+		return -1;
+	}
+	map->regs = (volatile uint32_t *)p;
+	return 0;
+}
+
+static inline void aja_regmap_close(aja_regmap_t *map) {
+	if(map->regs) munmap((void *)map->regs, map->len);
+	map->regs = NULL;
+	return;
+}
+
+/* Reads any register field, the same as aja_getregister() without the ioctl */
+static inline uint32_t aja_regmap_get(const aja_regmap_t *map, const aja_register_t reg) {
+	if((map->flags & AJA_SmallReg) && (reg.add > 255)) return 0;
+	if(reg.add >= map->len) return 0;
+	return (map->regs[reg.add / 4] & reg.mask) >> reg.shift;
+}
+
+#define AJA_REGMAP_FIELD(val, reg) 	(((val) & ajareg_##reg.mask) >> ajareg_##reg.shift)
+
+static inline void aja_regmap_status(const aja_regmap_t *map, aja_regmap_status_t *st) {
+	volatile uint32_t *r = map->regs;
+	uint32_t global = r[ajareg_framerate.add / 4];
+	uint32_t status = r[ajareg_outputfield.add / 4];
+	uint32_t input = r[ajareg_input1framerate.add / 4];
+
+	st->outputline = ajareg_get_outputline(r);
+	st->outputfield = AJA_REGMAP_FIELD(status, outputfield);
+	st->audiocount = ajareg_get_audiocount(r);
+	st->acaplast = ajareg_get_acaplast(r);
+	st->aplaylast = ajareg_get_aplaylast(r);
+	st->framerate = AJA_REGMAP_FIELD(global, framerate);
+	st->framegeo = AJA_REGMAP_FIELD(global, framegeo);
+	st->standard = AJA_REGMAP_FIELD(global, standard);
+	st->input1framerate = AJA_REGMAP_FIELD(input, input1framerate);
+	st->input1format = AJA_REGMAP_FIELD(input, input1format);
+	st->input1prog = AJA_REGMAP_FIELD(input, input1prog);
+	st->input2framerate = AJA_REGMAP_FIELD(input, input2framerate);
+	st->input2format = AJA_REGMAP_FIELD(input, input2format);
+	st->input2prog = AJA_REGMAP_FIELD(input, input2prog);
+	st->fpgaversion = AJA_REGMAP_FIELD(status, fpgaversion);
+	st->boardversion = AJA_REGMAP_FIELD(status, boardversion);
+	return;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ifndef _AJA_REGMAP_H_ */
+
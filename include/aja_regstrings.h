@@ -976,6 +976,10 @@ static const aja_regoption_t regopt_dma4next_high[] = {
 	{NULL, 0}
 };
 
+static const aja_regoption_t regopt_dmastatus[] = {
+	{NULL, 0}
+};
+
 static const aja_regoption_t regopt_downconvmode[] = {
 	{"anamorphic", 2},
 	{"crop", 1},
@@ -1208,6 +1212,10 @@ static const aja_regoption_t regopt_input2vblank[] = {
 	{NULL, 0}
 };
 
+static const aja_regoption_t regopt_irqstatus[] = {
+	{NULL, 0}
+};
+
 static const aja_regoption_t regopt_kboxinput[] = {
 	{"bnc", 0},
 	{"xlr", 1},
@@ -1973,6 +1981,7 @@ static const aja_regstring_t regstring[] = {
 	{"dma4irqclear", "Clear DMA 4 IRQ", (const aja_register_t *)&ajareg_dma4irqclear, (const aja_regoption_t *)&regopt_dma4irqclear, 0x2},
 	{"dma4irqenable", "DMA 4 IRQ Enable", (const aja_register_t *)&ajareg_dma4irqenable, (const aja_regoption_t *)&regopt_dma4irqenable, 0x3},
 	{"dma4next_high", "DMA 1 Next Descriptor Address (MSB 32)", (const aja_register_t *)&ajareg_dma4next_high, (const aja_regoption_t *)&regopt_dma4next_high, 0x3},
+	{"dmastatus", "DMA Status (whole register)", (const aja_register_t *)&ajareg_dmastatus, (const aja_regoption_t *)&regopt_dmastatus, 0x1},
 	{"downconvmode", "Downconversion Mode", (const aja_register_t *)&ajareg_downconvmode, (const aja_regoption_t *)&regopt_downconvmode, 0x7},
 	{"eaud1c12", "Embedded Audio Group 1 - Ch 1/2 Present", (const aja_register_t *)&ajareg_eaud1c12, (const aja_regoption_t *)&regopt_eaud1c12, 0x1},
 	{"eaud1c34", "Embedded Audio Group 1 - Ch 3/4 Present", (const aja_register_t *)&ajareg_eaud1c34, (const aja_regoption_t *)&regopt_eaud1c34, 0x1},
@@ -2016,6 +2025,7 @@ static const aja_regstring_t regstring[] = {
 	{"input2irqenable", "Input2 IRQ Enable", (const aja_register_t *)&ajareg_input2irqenable, (const aja_regoption_t *)&regopt_input2irqenable, 0x3},
 	{"input2prog", "Input 2 Progressive Flag", (const aja_register_t *)&ajareg_input2prog, (const aja_regoption_t *)&regopt_input2prog, 0x1},
 	{"input2vblank", "Input 2 Vertical Blank Active", (const aja_register_t *)&ajareg_input2vblank, (const aja_regoption_t *)&regopt_input2vblank, 0x1},
+	{"irqstatus", "IRQ Status (whole register)", (const aja_register_t *)&ajareg_irqstatus, (const aja_regoption_t *)&regopt_irqstatus, 0x1},
 	{"kboxinput", "KBOX Input Selection", (const aja_register_t *)&ajareg_kboxinput, (const aja_regoption_t *)&regopt_kboxinput, 0x7},
 	{"kboxmonitor", "KBOX Audio Monitor Output", (const aja_register_t *)&ajareg_kboxmonitor, (const aja_regoption_t *)&regopt_kboxmonitor, 0x7},
 	{"leds", "Card LEDs", (const aja_register_t *)&ajareg_leds, (const aja_regoption_t *)&regopt_leds, 0x3},
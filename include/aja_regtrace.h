@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * aja_regtrace.h
+ *
+ * Creation Date: October 19, 2026
+ * Author(s):
+ *
+ *
+ * Copyright (c) 2026, SpectSoft
+ *   All Rights Reserved.
+ *   http://www.spectsoft.com/
+ *   info@spectsoft.com
+ *
+ * $Id$
+ *
+ * DESC: Register access trace format.  The trace is always compiled in and
+ *       is enabled by loading the driver with regtrace=1.  The trace is read
+ *       from <debugfs>/aja/regtrace as an aja_regtrace_hdr_t followed by
+ *       'count' aja_regtrace_t records, one per-CPU ring after another (so
+ *       not in time order).  Writing anything to the file clears the rings.
+ *
+ ******************************************************************************/
+#ifndef _AJA_REGTRACE_H_
+#define _AJA_REGTRACE_H_
+
+#ifndef __KERNEL__
+#include <stdint.h>
+#endif
+
+#define AJA_REGTRACE_MAGIC 	0x54524A41		/* "AJRT" */
+#define AJA_REGTRACE_VERSION 	1
+#define AJA_REGTRACE_ENTRIES 	4096			/* Records per CPU, must be a power of 2 */
+
+enum aja_regtrace_op {
+	AJA_TraceRead 		= 0,
+	AJA_TraceWrite 		= 1
+};
+
+/* Context the access was made from */
+enum aja_regtrace_ctx {
+	AJA_TraceProcess 	= 0,		/* Process context (ioctls, the IRQ thread, workers) */
+	AJA_TraceSoftIRQ 	= 1,		/* Softirq or tasklet */
+	AJA_TraceHardIRQ 	= 2		/* Hard IRQ handler */
+};
+
+typedef struct {
+	uint32_t 		magic;		/* AJA_REGTRACE_MAGIC */
+	uint32_t 		version;	/* AJA_REGTRACE_VERSION */
+	uint32_t 		size;		/* sizeof(aja_regtrace_t) */
+	uint32_t 		count;		/* Number of records that follow */
+} aja_regtrace_hdr_t;
+
+typedef struct {
+	uint64_t 		tstamp;		/* Monotonic time in ns */
+	uint64_t 		caller;		/* Kernel address of the calling function */
+	uint32_t 		add;		/* Register byte address */
+	uint32_t 		value;		/* Value read or the whole value written */
+	int32_t 		pid;		/* Current pid */
+	uint8_t 		op;		/* aja_regtrace_op */
+	uint8_t 		ctx;		/* aja_regtrace_ctx */
+	uint8_t 		card;		/* Card index */
+	uint8_t 		cpu;		/* CPU the access was made on */
+} aja_regtrace_t;
+
+#endif /* ifndef _AJA_REGTRACE_H_ */
+
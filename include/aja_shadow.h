@@ -0,0 +1,329 @@
+/* AJA CARD SHADOW REGISTERS 
+ * THIS FILE IS AUTOMATICALY GENERATED BY THE SPECTSOFT AJA-DRIVER PACKAGE */
+
+
+#ifndef _AJA_SHADOW_H_
+#define _AJA_SHADOW_H_
+
+
+#ifndef __KERNEL__
+#include <stdint.h>
+#endif
+
+#define AJA_SHADOW_REGS 152
+
+/* Is the card register written from the shadow (1) or read-modify-written (0) */
+static const uint8_t aja_shadow_cached[AJA_SHADOW_REGS] = {
+	1,	/* Reg 0 */
+	1,	/* Reg 1 */
+	0,	/* Reg 2 */
+	0,	/* Reg 3 */
+	0,	/* Reg 4 */
+	1,	/* Reg 5 */
+	0,	/* Reg 6 */
+	0,	/* Reg 7 */
+	0,	/* Reg 8 */
+	1,	/* Reg 9 */
+	1,	/* Reg 10 */
+	1,	/* Reg 11 */
+	1,	/* Reg 12 */
+	1,	/* Reg 13 */
+	1,	/* Reg 14 */
+	1,	/* Reg 15 */
+	0,	/* Reg 16 */
+	0,	/* Reg 17 */
+	0,	/* Reg 18 */
+	0,	/* Reg 19 */
+	1,	/* Reg 20 */
+	0,	/* Reg 21 */
+	0,	/* Reg 22 */
+	0,	/* Reg 23 */
+	1,	/* Reg 24 */
+	1,	/* Reg 25 */
+	0,	/* Reg 26 */
+	0,	/* Reg 27 */
+	0,	/* Reg 28 */
+	0,	/* Reg 29 */
+	0,	/* Reg 30 */
+	0,	/* Reg 31 */
+	0,	/* Reg 32 */
+	0,	/* Reg 33 */
+	0,	/* Reg 34 */
+	0,	/* Reg 35 */
+	0,	/* Reg 36 */
+	0,	/* Reg 37 */
+	0,	/* Reg 38 */
+	0,	/* Reg 39 */
+	0,	/* Reg 40 */
+	0,	/* Reg 41 */
+	0,	/* Reg 42 */
+	0,	/* Reg 43 */
+	0,	/* Reg 44 */
+	0,	/* Reg 45 */
+	0,	/* Reg 46 */
+	0,	/* Reg 47 */
+	0,	/* Reg 48 */
+	1,	/* Reg 49 */
+	0,	/* Reg 50 */
+	0,	/* Reg 51 */
+	0,	/* Reg 52 */
+	0,	/* Reg 53 */
+	0,	/* Reg 54 */
+	0,	/* Reg 55 */
+	0,	/* Reg 56 */
+	0,	/* Reg 57 */
+	0,	/* Reg 58 */
+	0,	/* Reg 59 */
+	0,	/* Reg 60 */
+	0,	/* Reg 61 */
+	0,	/* Reg 62 */
+	0,	/* Reg 63 */
+	0,	/* Reg 64 */
+	0,	/* Reg 65 */
+	0,	/* Reg 66 */
+	0,	/* Reg 67 */
+	0,	/* Reg 68 */
+	0,	/* Reg 69 */
+	1,	/* Reg 70 */
+	0,	/* Reg 71 */
+	0,	/* Reg 72 */
+	0,	/* Reg 73 */
+	0,	/* Reg 74 */
+	0,	/* Reg 75 */
+	0,	/* Reg 76 */
+	0,	/* Reg 77 */
+	0,	/* Reg 78 */
+	0,	/* Reg 79 */
+	0,	/* Reg 80 */
+	0,	/* Reg 81 */
+	0,	/* Reg 82 */
+	0,	/* Reg 83 */
+	0,	/* Reg 84 */
+	0,	/* Reg 85 */
+	0,	/* Reg 86 */
+	0,	/* Reg 87 */
+	0,	/* Reg 88 */
+	0,	/* Reg 89 */
+	0,	/* Reg 90 */
+	0,	/* Reg 91 */
+	0,	/* Reg 92 */
+	0,	/* Reg 93 */
+	0,	/* Reg 94 */
+	0,	/* Reg 95 */
+	0,	/* Reg 96 */
+	0,	/* Reg 97 */
+	0,	/* Reg 98 */
+	0,	/* Reg 99 */
+	0,	/* Reg 100 */
+	0,	/* Reg 101 */
+	0,	/* Reg 102 */
+	0,	/* Reg 103 */
+	0,	/* Reg 104 */
+	0,	/* Reg 105 */
+	0,	/* Reg 106 */
+	0,	/* Reg 107 */
+	0,	/* Reg 108 */
+	0,	/* Reg 109 */
+	0,	/* Reg 110 */
+	0,	/* Reg 111 */
+	0,	/* Reg 112 */
+	0,	/* Reg 113 */
+	0,	/* Reg 114 */
+	0,	/* Reg 115 */
+	0,	/* Reg 116 */
+	0,	/* Reg 117 */
+	0,	/* Reg 118 */
+	0,	/* Reg 119 */
+	0,	/* Reg 120 */
+	0,	/* Reg 121 */
+	0,	/* Reg 122 */
+	0,	/* Reg 123 */
+	0,	/* Reg 124 */
+	0,	/* Reg 125 */
+	0,	/* Reg 126 */
+	0,	/* Reg 127 */
+	1,	/* Reg 128 */
+	1,	/* Reg 129 */
+	1,	/* Reg 130 */
+	1,	/* Reg 131 */
+	0,	/* Reg 132 */
+	0,	/* Reg 133 */
+	0,	/* Reg 134 */
+	0,	/* Reg 135 */
+	1,	/* Reg 136 */
+	1,	/* Reg 137 */
+	1,	/* Reg 138 */
+	1,	/* Reg 139 */
+	1,	/* Reg 140 */
+	0,	/* Reg 141 */
+	1,	/* Reg 142 */
+	1,	/* Reg 143 */
+	1,	/* Reg 144 */
+	1,	/* Reg 145 */
+	1,	/* Reg 146 */
+	1,	/* Reg 147 */
+	1,	/* Reg 148 */
+	1,	/* Reg 149 */
+	1,	/* Reg 150 */
+	1,	/* Reg 151 */
+};
+
+/* Bits of each card register kept in the shadow */
+static const uint32_t aja_shadow_keep[AJA_SHADOW_REGS] = {
+	0xF8FF9FFFu,	/* Reg 0 */
+	0x01011F7Fu,	/* Reg 1 */
+	0x00000000u,	/* Reg 2 */
+	0x00000000u,	/* Reg 3 */
+	0x00000000u,	/* Reg 4 */
+	0x0001169Fu,	/* Reg 5 */
+	0x00000000u,	/* Reg 6 */
+	0x00000000u,	/* Reg 7 */
+	0x00000000u,	/* Reg 8 */
+	0x73F01FFFu,	/* Reg 9 */
+	0x00077777u,	/* Reg 10 */
+	0xFFFFFFFFu,	/* Reg 11 */
+	0xFFFFFFFFu,	/* Reg 12 */
+	0x3FFFFFFFu,	/* Reg 13 */
+	0xFFFFFFFFu,	/* Reg 14 */
+	0xC0FFFFFFu,	/* Reg 15 */
+	0x00000000u,	/* Reg 16 */
+	0x00000000u,	/* Reg 17 */
+	0x00000000u,	/* Reg 18 */
+	0x00000000u,	/* Reg 19 */
+	0x000001FFu,	/* Reg 20 */
+	0x00000000u,	/* Reg 21 */
+	0x00000000u,	/* Reg 22 */
+	0x00000000u,	/* Reg 23 */
+	0xC71FAB7Fu,	/* Reg 24 */
+	0x0001FFFFu,	/* Reg 25 */
+	0x00000000u,	/* Reg 26 */
+	0x00000000u,	/* Reg 27 */
+	0x00000000u,	/* Reg 28 */
+	0x00000000u,	/* Reg 29 */
+	0x00000000u,	/* Reg 30 */
+	0x00000000u,	/* Reg 31 */
+	0x00000000u,	/* Reg 32 */
+	0x00000000u,	/* Reg 33 */
+	0x00000000u,	/* Reg 34 */
+	0x00000000u,	/* Reg 35 */
+	0x00000000u,	/* Reg 36 */
+	0x00000000u,	/* Reg 37 */
+	0x00000000u,	/* Reg 38 */
+	0x00000000u,	/* Reg 39 */
+	0x00000000u,	/* Reg 40 */
+	0x00000000u,	/* Reg 41 */
+	0x00000000u,	/* Reg 42 */
+	0x00000000u,	/* Reg 43 */
+	0x00000000u,	/* Reg 44 */
+	0x00000000u,	/* Reg 45 */
+	0x00000000u,	/* Reg 46 */
+	0x00000000u,	/* Reg 47 */
+	0x00000000u,	/* Reg 48 */
+	0x0000001Fu,	/* Reg 49 */
+	0x00000000u,	/* Reg 50 */
+	0x00000000u,	/* Reg 51 */
+	0x00000000u,	/* Reg 52 */
+	0x00000000u,	/* Reg 53 */
+	0x00000000u,	/* Reg 54 */
+	0x00000000u,	/* Reg 55 */
+	0x00000000u,	/* Reg 56 */
+	0x00000000u,	/* Reg 57 */
+	0x00000000u,	/* Reg 58 */
+	0x00000000u,	/* Reg 59 */
+	0x00000000u,	/* Reg 60 */
+	0x00000000u,	/* Reg 61 */
+	0x00000000u,	/* Reg 62 */
+	0x00000000u,	/* Reg 63 */
+	0x00000000u,	/* Reg 64 */
+	0x00000000u,	/* Reg 65 */
+	0x00000000u,	/* Reg 66 */
+	0x00000000u,	/* Reg 67 */
+	0x00000000u,	/* Reg 68 */
+	0x00000000u,	/* Reg 69 */
+	0x00000000u,	/* Reg 70 */
+	0x00000000u,	/* Reg 71 */
+	0x00000000u,	/* Reg 72 */
+	0x00000000u,	/* Reg 73 */
+	0x00000000u,	/* Reg 74 */
+	0x00000000u,	/* Reg 75 */
+	0x00000000u,	/* Reg 76 */
+	0x00000000u,	/* Reg 77 */
+	0x00000000u,	/* Reg 78 */
+	0x00000000u,	/* Reg 79 */
+	0x00000000u,	/* Reg 80 */
+	0x00000000u,	/* Reg 81 */
+	0x00000000u,	/* Reg 82 */
+	0x00000000u,	/* Reg 83 */
+	0x00000000u,	/* Reg 84 */
+	0x00000000u,	/* Reg 85 */
+	0x00000000u,	/* Reg 86 */
+	0x00000000u,	/* Reg 87 */
+	0x00000000u,	/* Reg 88 */
+	0x00000000u,	/* Reg 89 */
+	0x00000000u,	/* Reg 90 */
+	0x00000000u,	/* Reg 91 */
+	0x00000000u,	/* Reg 92 */
+	0x00000000u,	/* Reg 93 */
+	0x00000000u,	/* Reg 94 */
+	0x00000000u,	/* Reg 95 */
+	0x00000000u,	/* Reg 96 */
+	0x00000000u,	/* Reg 97 */
+	0x00000000u,	/* Reg 98 */
+	0x00000000u,	/* Reg 99 */
+	0x00000000u,	/* Reg 100 */
+	0x00000000u,	/* Reg 101 */
+	0x00000000u,	/* Reg 102 */
+	0x00000000u,	/* Reg 103 */
+	0x00000000u,	/* Reg 104 */
+	0x00000000u,	/* Reg 105 */
+	0x00000000u,	/* Reg 106 */
+	0x00000000u,	/* Reg 107 */
+	0x00000000u,	/* Reg 108 */
+	0x00000000u,	/* Reg 109 */
+	0x00000000u,	/* Reg 110 */
+	0x00000000u,	/* Reg 111 */
+	0x00000000u,	/* Reg 112 */
+	0x00000000u,	/* Reg 113 */
+	0x00000000u,	/* Reg 114 */
+	0x00000000u,	/* Reg 115 */
+	0x00000000u,	/* Reg 116 */
+	0x00000000u,	/* Reg 117 */
+	0x00000000u,	/* Reg 118 */
+	0x00000000u,	/* Reg 119 */
+	0x00000000u,	/* Reg 120 */
+	0x00000000u,	/* Reg 121 */
+	0x00000000u,	/* Reg 122 */
+	0x00000000u,	/* Reg 123 */
+	0x00000000u,	/* Reg 124 */
+	0x00000000u,	/* Reg 125 */
+	0x00000000u,	/* Reg 126 */
+	0x00000000u,	/* Reg 127 */
+	0x0000001Fu,	/* Reg 128 */
+	0x0000008Fu,	/* Reg 129 */
+	0x0000008Fu,	/* Reg 130 */
+	0x00307777u,	/* Reg 131 */
+	0x00000000u,	/* Reg 132 */
+	0x00000000u,	/* Reg 133 */
+	0x00000000u,	/* Reg 134 */
+	0x00000000u,	/* Reg 135 */
+	0xFFFFFFFFu,	/* Reg 136 */
+	0xFF0000FFu,	/* Reg 137 */
+	0xFFFFFFFFu,	/* Reg 138 */
+	0xFFFFFFFFu,	/* Reg 139 */
+	0xFFFFFFFFu,	/* Reg 140 */
+	0x00000000u,	/* Reg 141 */
+	0xE7FF07FFu,	/* Reg 142 */
+	0x87FF07FFu,	/* Reg 143 */
+	0x07FF07FFu,	/* Reg 144 */
+	0x07FF07FFu,	/* Reg 145 */
+	0x07FF07FFu,	/* Reg 146 */
+	0xE7FF07FFu,	/* Reg 147 */
+	0x87FF07FFu,	/* Reg 148 */
+	0x07FF07FFu,	/* Reg 149 */
+	0x07FF07FFu,	/* Reg 150 */
+	0x07FF07FFu,	/* Reg 151 */
+};
+
+
+#endif /* _AJA_SHADOW_H_ defined */
+
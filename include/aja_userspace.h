@@ -23,6 +23,8 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
 #include <string.h>
 
 #ifdef _cplusplus
@@ -52,6 +54,14 @@ static inline int aja_setregister(int fd, const aja_register_t reg, uint32_t val
 	return ioctl(fd, AJACTL_SETREGISTER, &rio);
 }
 
+static inline int aja_registerv(int fd, aja_registerio_t *regs, int count, int flags) {
+	aja_registerv_t rv;
+	rv.count = count;
+	rv.flags = flags;
+	rv.regs = regs;
+	return ioctl(fd, AJACTL_REGISTERV, &rv);
+}
+
 static inline uint64_t aja_getirqcount(int fd, int type) {
 	aja_irqcountget_t get;
 	get.type = type;
@@ -59,10 +69,112 @@ static inline uint64_t aja_getirqcount(int fd, int type) {
 	return get.count;
 }
 
+static inline int aja_irqtiming(int fd, aja_timing_t *timing) {
+	return ioctl(fd, AJACTL_IRQTIMING, timing);
+}
+
 static inline int aja_irqsleep(int fd, int type) {
 	return ioctl(fd, AJACTL_IRQSLEEP, type);
 }
 
+/* Sleeps until frame 'id' starts.  'deadline' is on the aja_frametime_t.mono clock
+ * (ns, see aja_clocksync_frame), 0 for none.  Returns 0, or -1 with errno
+ * ETIMEDOUT if the deadline passed first */
+static inline int aja_frame_waituntil(int fd, int64_t id, int64_t deadline, aja_frametime_t *time) {
+	aja_frame_waituntil_t wu;
+	int ret;
+	memset(&wu, 0, sizeof(wu));
+	wu.id = id;
+	wu.deadline = deadline;
+	ret = ioctl(fd, AJACTL_FRAME_WAITUNTIL, &wu);
+	if(time) *time = wu.time;
+	return ret;
+}
+
+static inline int aja_clocksync(int fd, aja_clocksync_t *cs) {
+	return ioctl(fd, AJACTL_CLOCKSYNC, cs);
+}
+
+/* Predicted system time (aja_frametime_t.mono clock, ns) that frame 'id' starts */
+static inline int64_t aja_clocksync_frame(const aja_clocksync_t *cs, int64_t id) {
+	return cs->id_mono + (int64_t)((double)(id - cs->id) * (double)cs->period / 65536.0);
+}
+
+/* System time (ns) of a 48KHz count, extended to 64 bits the same way as cs->count */
+static inline int64_t aja_clocksync_count(const aja_clocksync_t *cs, uint64_t count) {
+	return cs->count_mono + (int64_t)((double)(int64_t)(count - cs->count) * (1000000000.0 + cs->drift) / 48000.0);
+}
+
+/* Maps the frame clock page of an open card device.  Returns NULL on failure */
+static inline const aja_frameclock_t *aja_frameclock_map(int fd) {
+	void *p = mmap(NULL, getpagesize(), PROT_READ, MAP_SHARED, fd, AJA_MMAP_FRAMECLOCK * getpagesize());
+	if(p == MAP_FAILED) return NULL;
+	return (const aja_frameclock_t *)p;
+}
+
+static inline void aja_frameclock_unmap(const aja_frameclock_t *clk) {
+	if(clk) munmap((void *)clk, getpagesize());
+	return;
+}
+
+/* Takes a consistent copy of the frame clock, no syscall */
+static inline void aja_frameclock_read(const aja_frameclock_t *clk, aja_frameclock_t *out) {
+	uint32_t seq;
+	do {
+		seq = clk->seq;
+		__sync_synchronize();
+		memcpy(out, (const void *)clk, sizeof(*out));
+		__sync_synchronize();
+	} while((seq & 1) || seq != clk->seq);
+	out->seq = seq;
+	return;
+}
+
+static inline int aja_afeed_init(int fd, aja_afeed_init_t *init) {
+	return ioctl(fd, AJACTL_AFEED_INIT, init);
+}
+
+static inline int aja_afeed_start(int fd) {
+	return ioctl(fd, AJACTL_AFEED_START);
+}
+
+static inline int aja_afeed_stop(int fd) {
+	return ioctl(fd, AJACTL_AFEED_STOP);
+}
+
+static inline int aja_afeed_commit(int fd, uint32_t bytes) {
+	return ioctl(fd, AJACTL_AFEED_COMMIT, &bytes);
+}
+
+static inline int aja_afeed_status(int fd, aja_afeed_status_t *st) {
+	return ioctl(fd, AJACTL_AFEED_STATUS, st);
+}
+
+/* Maps the feeder host ring set up by aja_afeed_init().  Returns NULL on failure */
+static inline uint8_t *aja_afeed_map(int fd, uint32_t size) {
+	void *p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, AJA_MMAP_AFEED * getpagesize());
+	if(p == MAP_FAILED) return NULL;
+	return (uint8_t *)p;
+}
+
+static inline void aja_afeed_unmap(uint8_t *p, uint32_t size) {
+	if(p) munmap((void *)p, size);
+	return;
+}
+
+/* Bytes the producer can write now */
+static inline uint32_t aja_afeed_space(const aja_afeed_status_t *st) {
+	return st->size - (uint32_t)(st->written - st->read);
+}
+
+static inline int aja_avdrift(int fd, aja_avdrift_t *st) {
+	return ioctl(fd, AJACTL_AVDRIFT, st);
+}
+
+static inline int aja_uart_stats(int fd, aja_uartstats_t *st) {
+	return ioctl(fd, AJACTL_UART_STATS, st);
+}
+
 static inline int aja_dmatocard(int fd, int engine, void *buffer, uint32_t cardadd, uint32_t len) {
 	aja_dmainfo_t dma;
 	dma.engine = engine;
@@ -148,6 +260,60 @@ static inline int aja_stream_settrigger(int fd, int64_t id) {
 	return ioctl(fd, AJACTL_STREAM_SETTRIG, &id);
 }
 
+/* Ends the overwrite phase of an AJA_CaptureRing stream.  The last 'preroll'
+ * frames stay in the fifo, and every frame after them is kept as normal. */
+static inline int aja_stream_record(int fd, int preroll) {
+	return ioctl(fd, AJACTL_STREAM_RECORD, &preroll);
+}
+
+static inline int aja_stream_audioring(int fd, aja_audioring_t *ring) {
+	return ioctl(fd, AJACTL_STREAM_AUDIORING, ring);
+}
+
+/* Maps the captured audio ring of an AJA_CaptureAudio stream.  A frame's audio is
+ * at ring + meta.audiooffset.  Returns NULL on failure */
+static inline const uint8_t *aja_audioring_map(int fd, const aja_audioring_t *ring) {
+	void *p;
+	if(!ring->size) return NULL;
+	p = mmap(NULL, ring->size, PROT_READ, MAP_SHARED, fd, AJA_MMAP_AUDIO * getpagesize());
+	if(p == MAP_FAILED) return NULL;
+	return (const uint8_t *)p;
+}
+
+static inline void aja_audioring_unmap(const uint8_t *p, const aja_audioring_t *ring) {
+	if(p) munmap((void *)p, ring->size);
+	return;
+}
+
+static inline int aja_stream_playlist(int fd, const aja_stream_playlist_t *list) {
+	return ioctl(fd, AJACTL_STREAM_PLAYLIST, list);
+}
+
+/* Loads a playlist of 'count' frames starting at card page 'first' */
+static inline int aja_stream_playlist_range(int fd, int chans, int first, int count, int loops) {
+	aja_stream_playlist_t list;
+	int i;
+	if(chans < 1) chans = 1;
+	if(count * chans > AJA_MAXPAGES) return -1;
+	memset(&list, 0, sizeof(list));
+	list.count = count;
+	list.in = 0;
+	list.out = count - 1;
+	list.loops = loops;
+	for(i = 0; i < count * chans; i++) list.pages[i] = first + i;
+	return ioctl(fd, AJACTL_STREAM_PLAYLIST, &list);
+}
+
+static inline int aja_stream_playlist_clear(int fd) {
+	aja_stream_playlist_t list;
+	memset(&list, 0, sizeof(list));
+	return ioctl(fd, AJACTL_STREAM_PLAYLIST, &list);
+}
+
+static inline int aja_stream_playlist_pos(int fd) {
+	return ioctl(fd, AJACTL_STREAM_PLAYLIST_POS);
+}
+
 static inline int aja_stream_setspeed(int fd, double speed) {
 	int val = (int)(speed * AJA_SPEED_DIVISOR);
 	return ioctl(fd, AJACTL_STREAM_SETSPEED, &val);
@@ -23,18 +23,35 @@
 #include <stdint.h>
 #endif
 
-#define P2SLAVE_API_VERSION	20100420
+#define P2SLAVE_API_VERSION	20261019
 #define P2SLAVE_PKTSIZE		32
 
 #include <linux/ioctl.h>
 #include <timecode.h>
 
-/** This structure is the data unit returned by reading the /dev/p2slave device */
+/** This structure is the data unit returned by reading the /dev/p2slave device,
+ * and a slot of the packet ring */
 struct p2slave_pkt_t {
-	struct timeval 			tstamp;
+	int64_t 			tstamp;		// CLOCK_MONOTONIC_RAW receive time, ns (CLOCK_MONOTONIC before 2.6.28)
 	uint8_t				data[P2SLAVE_PKTSIZE];
 };
 
+/** The packet ring, mmap() of the device at offset 0 for P2SLAVE_IOC_RINGSIZE
+ * bytes, read and write.  The driver fills slot (write % slots) and then bumps
+ * 'write'; the reader takes slots up to 'write' and then sets 'read' past them.
+ * When 'slots' packets are unread the driver drops new ones and counts them in
+ * 'overflows'.  The indexes run free and wrap at 32 bits.  read() takes packets
+ * from the same ring, so a process uses one or the other. */
+struct p2slave_ring_t {
+	volatile uint32_t 		write;		// Packets written by the driver
+	uint32_t 			slots;		// Ring slots, a power of 2
+	volatile uint32_t 		overflows;	// Packets dropped because the ring was full
+	uint32_t 			pad0[13];
+	volatile uint32_t 		read;		// Packets taken by the reader
+	uint32_t 			pad1[15];
+	struct p2slave_pkt_t 		pkt[];
+};
+
 struct p2slave_status_t {
 	uint8_t				data[16];
 };
@@ -50,6 +67,17 @@ struct p2slave_status_t {
 #define P2SLAVE_IOC_SETAOUT		_IOW(P2SLAVE_IOC_MAGIC, 8, timecode_t)
 #define P2SLAVE_IOC_SETPREROLL 		_IOW(P2SLAVE_IOC_MAGIC, 9, timecode_t)
 #define P2SLAVE_IOC_SETSPEED 		_IOW(P2SLAVE_IOC_MAGIC, 10, int)
+#define P2SLAVE_IOC_RINGSIZE 		_IOR(P2SLAVE_IOC_MAGIC, 12, uint32_t)	/* Bytes to mmap() for the packet ring */
+
+/* tty line discipline.  The kernel has no number to spare for it, so it is only
+ * registered when the module is loaded with ldisc=<n>, a number below NR_LDISCS
+ * that no discipline on the system uses (the kernel doesn't check), and the
+ * number in use is in /sys/module/p2slave/parameters/ldisc.  Set the line up
+ * (38400 baud, 8 data bits, odd parity) and attach it with TIOCSETD, the port
+ * then answers as a P2 slave and gets its own /dev/p2slave device.
+ * P2SLAVE_TIOCGINDEX on the tty returns the index of its p2slave device. */
+#define P2SLAVE_LDISC_PARAM 		"/sys/module/p2slave/parameters/ldisc"
+#define P2SLAVE_TIOCGINDEX 		_IOR(P2SLAVE_IOC_MAGIC, 11, int)
 
 /* Exported kernel functions */
 #ifdef __KERNEL__
@@ -77,7 +105,7 @@ void p2slave_set_id(struct p2slave_t *, uint16_t idval);
 /** Sets the vtr status data */
 void p2slave_set_status(struct p2slave_t *, const struct p2slave_status_t *);
 
-/** Sets the vtr timecode */
+/** Sets the vtr timecode.  Call it once a frame, it rebuilds the timecode sense replies */
 void p2slave_set_tc(struct p2slave_t *, const timecode_t *);
 
 /** Sets the vtr timecode generator */
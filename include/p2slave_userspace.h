@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * p2slave_userspace.h
+ *
+ * Creation Date: October 19, 2026
+ * Author(s):
+ *
+ *
+ * Copyright (c) 2026, SpectSoft
+ *   All Rights Reserved.
+ *   http://www.spectsoft.com/
+ *   info@spectsoft.com
+ *
+ * $Id$
+ *
+ * DESC: Userspace functions for the p2slave packet ring
+ *
+ ******************************************************************************/
+#ifndef _P2SLAVE_USERSPACE_H_
+#define _P2SLAVE_USERSPACE_H_
+
+#include <sys/types.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <p2slave.h>
+
+/* Maps the packet ring of an open p2slave device, setting 'size' to the mapped
+ * bytes.  Returns NULL on failure */
+static inline struct p2slave_ring_t *p2slave_ring_map(int fd, uint32_t *size) {
+	void *p;
+	if(ioctl(fd, P2SLAVE_IOC_RINGSIZE, size)) return NULL;
+	p = mmap(NULL, *size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if(p == MAP_FAILED) return NULL;
+	return (struct p2slave_ring_t *)p;
+}
+
+static inline void p2slave_ring_unmap(struct p2slave_ring_t *ring, uint32_t size) {
+	if(ring) munmap((void *)ring, size);
+	return;
+}
+
+/* Returns the next unread packet, or NULL if the ring is empty.  poll() the
+ * device to wait for one */
+static inline const struct p2slave_pkt_t *p2slave_ring_peek(const struct p2slave_ring_t *ring) {
+	uint32_t rp = ring->read;
+	if(rp == ring->write) return NULL;
+	__sync_synchronize();
+	return &ring->pkt[rp & (ring->slots - 1)];
+}
+
+/* Hands the packet returned by p2slave_ring_peek() back to the driver */
+static inline void p2slave_ring_next(struct p2slave_ring_t *ring) {
+	__sync_synchronize();
+	ring->read++;
+	return;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ifndef _P2SLAVE_USERSPACE_H_ */
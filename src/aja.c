@@ -34,13 +34,33 @@
 #include <asm/atomic.h>
 #include <linux/delay.h>
 #include <linux/interrupt.h>
+#include <linux/hrtimer.h>
 #include <asm/bitops.h>
 #include <linux/spinlock.h>
 #include <linux/scatterlist.h>
 #include <linux/wait.h>
+#include <linux/vmalloc.h>
+#include <linux/debugfs.h>
+#include <linux/percpu.h>
+
+/* The audio ring transfers (AJA_CaptureAudio, the feeder and the ALSA PCM) wait
+ * for their DMA in the IRQ thread.  Without threaded IRQs that wait would be in
+ * the hard IRQ, so they are refused */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,30)
+#define AJA_AUDIO_RINGS
+#endif
+
+/* Each card's audio is also an ALSA PCM when the kernel has ALSA */
+#if defined(AJA_AUDIO_RINGS) && (defined(CONFIG_SND) || defined(CONFIG_SND_MODULE))
+#define AJA_ALSA
+#include <sound/core.h>
+#include <sound/pcm.h>
+#endif
 
 #include <aja_ioctls.h>
 #include <aja_registers.h>
+#include <aja_shadow.h>
+#include <aja_regtrace.h>
 #include <p2slave.h>
 #include "timecode.h"
 #include "utils.h"
@@ -66,6 +86,11 @@ static int 			max_dmalist 		= 4000; 		/* Maximum number of scatter gather list i
 static int 			use_dma64		= 1;			/* Should use 64bit DMA (if supported)*/
 static int 			dma_merge		= 1; 			/* DMA should attempt to merge adjacent pages */
 static int			api_version		= AJA_API_VERSION;
+static int 			regtrace		= 0;			/* Record register accesses to debugfs aja/regtrace */
+static int 			alsa			= 0;			/* Register each card's audio as an ALSA PCM */
+static int 			avdrift			= 2000;			/* A/V drift event limit, us (0 = off) */
+static int 			uart_fifo		= 0;			/* UART TX FIFO depth, bytes written per status read when empty (0 = one) */
+static int 			uart_timeout		= 10000;		/* Abandon a command after this long without a byte, us (0 = never) */
 
 module_param(force64, bool, S_IRUGO);
 module_param(max_play_speed, uint, S_IRUGO);
@@ -73,6 +98,11 @@ module_param(max_dmalist, int, S_IRUGO);
 module_param(use_dma64, bool, S_IRUGO);
 module_param(dma_merge, bool, S_IRUGO);
 module_param(api_version, int, S_IRUGO);
+module_param(regtrace, bool, S_IRUGO);
+module_param(alsa, bool, S_IRUGO);
+module_param(avdrift, int, S_IRUGO);
+module_param(uart_fifo, int, S_IRUGO);
+module_param(uart_timeout, int, S_IRUGO);
 
 /* private global driver data */
 static CLASS_T 			*aja_class = NULL;
@@ -326,6 +356,17 @@ typedef struct {
 	aja_register_t		reg_next_high;	/* card register for next dma destriptor (high 32bits) */
 } aja_dma_t;
 
+/* A batch of register field writes, see aja_regtx_begin() */
+#define AJA_REGTX_MAX 		8
+typedef struct {
+	int 				count;
+	struct {
+		uint32_t 		add;
+		uint32_t 		mask;
+		uint32_t 		value;
+	} reg[AJA_REGTX_MAX];
+} aja_regtx_t;
+
 typedef struct {
 	void 		*next;
 	void 		*prev;
@@ -338,6 +379,18 @@ typedef struct {
 	int 			type;
 } aja_lastpage_t;
 
+/* In-kernel playlist (loop playback) */
+typedef struct {
+	volatile int 			active;					/* Is the playlist being played? */
+	int 				count;					/* Number of entries */
+	int 				in;					/* First entry of the loop */
+	int 				out;					/* Last entry of the loop */
+	int 				loops;					/* Passes to play (0 = forever) */
+	int 				pos;					/* Next entry to play */
+	int 				pass;					/* Passes completed */
+	int 				pages[AJA_MAXPAGES];			/* Page list */
+} aja_playlist_t;
+
 /* Structure for playback pageflip engine */
 typedef struct {
 	pid_t 				pid;					/* PID that owns this stream */
@@ -352,11 +405,13 @@ typedef struct {
 	volatile aja_stream_drop_t	drop;					/* Dropped frames information */
 	volatile int64_t	 	trigger;				/* Trigger id */
 	volatile int 			atrig; 					/* Should trigger audio */
+	volatile int 			ring;					/* Capture overwrites the oldest frames */
 	aja_lastpage_t			last[AJA_MAXCHANS]; 			/* The last page allocated */
 	aja_stream_meta_t		meta[AJA_MAXPAGES];			/* Frame metadata */
 	aja_pageitem_t 			pagealloc[AJA_MAXPAGES]; 		/* Page allocation array */
 	aja_pageitem_t 			*pfirst; 				/* First page in the list */
 	aja_pageitem_t 			*plast; 				/* Last page in the list */
+	aja_playlist_t 			playlist;				/* Loop playback playlist */
 } aja_stream_t;
 
 enum aja_slavepkt_state {
@@ -367,12 +422,18 @@ enum aja_slavepkt_state {
 typedef struct {
 	uint8_t				in[64];					/* Input Data */
 	uint8_t				out[64];				/* Output Data */
-	volatile int64_t 		tstamp; 				/* Interrupt timestamp */
+	spinlock_t 			lock;					/* The UART IRQ against the timeout */
+	struct hrtimer 			timer;					/* Inter-byte timeout */
+	ktime_t 			rx_byte;				/* Timer clock time of the last bytes */
 	volatile int			state;					/* State */
 	volatile int			inpt;					/* Input Point */
 	volatile int			insize;					/* Input Data Size */
 	volatile int			outpt;					/* Output Point */
 	volatile int 			outsize;				/* Output Data Size */
+	int64_t 			rx_first;				/* Time of the first command byte, ns */
+	int64_t 			rx_last;				/* Time of the last command byte, ns */
+	int64_t 			tx_first;				/* Time of the first reply byte, ns */
+	aja_uartstats_t 		stats;					/* Statistics, protected by lock */
 } aja_slavepkt_t;
 
 enum aja_flags {
@@ -385,19 +446,200 @@ typedef struct {
 	atomic_t			running;			/* Running Flag */
 } aja_audio_t;
 
+#define AJA_AUDIO_DMA 			2				/* DMA engine for the audio capture and feeder */
+#define AJA_AUDIO_SAMPLEBYTES 		4				/* Bytes per sample per channel */
+#define AJA_AUDIO_RATE 			48000				/* Sample rate */
+#define AJA_ACAP_MAXSAMPLES 		2048				/* Largest frame slice, 23.976 is 2002 */
+#define AJA_AFEED_MAXSIZE 		(16 << 20)			/* Largest feeder host ring */
+
+/* Host pages the card DMAs audio to or from, mapped into userspace */
+typedef struct {
+	int 				npages;				/* Number of pages */
+	struct page 			**pages;			/* Pages */
+	dma_addr_t 			*bus;				/* Bus address of each page */
+	int 				dir;				/* PCI DMA direction */
+	int 				coherent;			/* A view of coherent memory, see aja_hostring_view() */
+} aja_hostring_t;
+
+/* Frame aligned audio capture (AJA_CaptureAudio).  The hard IRQ cuts the card
+ * capture buffer into one slice per frame, the IRQ thread DMAs each slice into
+ * its page's slot of the host ring */
+typedef struct {
+	struct semaphore 		lock;				/* Ring allocation and the slice DMA */
+	volatile int 			due;				/* A frame was captured, cut its slice at the next frame */
+	int 				valid;				/* pos is anchored to the card buffer */
+	uint32_t 			pos;				/* Card buffer offset of the next slice */
+	uint32_t 			acc;				/* Cadence remainder */
+	uint32_t 			num;				/* Samples per frame is num / den */
+	uint32_t 			den;				/* 0 = unknown rate, follow the card pointer */
+	uint32_t 			channels;			/* Audio channels */
+	uint32_t 			fbytes;				/* Bytes per sample frame */
+	uint32_t 			slotsize;			/* Ring bytes per stream page */
+	aja_hostring_t 			ring;				/* Host ring */
+	uint32_t 			cardoff[AJA_MAXPAGES];		/* Card buffer offset of each page's slice */
+} aja_acapring_t;
+
+/* One card audio pointer followed by the A/V drift monitor */
+typedef struct {
+	int 				valid;				/* Anchored, 'last' is good */
+	uint32_t 			last;				/* Card pointer at the last frame */
+	uint32_t 			rem;				/* Bytes moved short of a whole sample frame */
+	uint32_t 			acc;				/* Cadence remainder */
+	uint32_t 			frames;				/* Frames since the anchor */
+	int64_t 			samples;			/* Samples the pointer moved since the anchor */
+	int64_t 			expect;				/* Samples the frames since the anchor should have */
+} aja_avptr_t;
+
+/* A/V drift monitor (AJACTL_AVDRIFT).  Updated by the hard IRQ from the capture
+ * pointer it already reads, protected by spin_reg */
+typedef struct {
+	uint32_t 			num;				/* Samples per frame is num / den */
+	uint32_t 			den;				/* 0 = unknown rate, not measuring */
+	uint32_t 			fbytes;				/* Bytes per sample frame */
+	int32_t 			limit;				/* Event limit, samples (0 = off) */
+	aja_avptr_t 			cap;				/* Capture pointer */
+	aja_avptr_t 			play;				/* Playback pointer */
+	int32_t 			skew;				/* Capture pointer ahead of the last slice, samples */
+	int32_t 			worst;				/* Largest drift, samples */
+	int 				over;				/* Past the limit, rearms below half of it */
+	uint32_t 			events;				/* Limit crossings */
+	uint32_t 			resets;				/* Pointer jumps */
+	int64_t 			event_id;			/* Frame of the last crossing */
+} aja_avmon_t;
+
+/* Audio playback feeder (AJACTL_AFEED_*).  Tops the card playback buffer up from
+ * the host ring in the IRQ thread */
+typedef struct {
+	struct semaphore 		lock;				/* Everything but hold and skip */
+	volatile int 			running;			/* Feeder is running */
+	uint32_t 			size;				/* Host ring bytes */
+	uint32_t 			watermark;			/* Top up below this many card bytes */
+	uint32_t 			target;				/* Top up to this many card bytes */
+	uint32_t 			fbytes;				/* Bytes per sample frame */
+	uint32_t 			num;				/* Samples per frame is num / den */
+	uint32_t 			den;
+	uint32_t 			acc;				/* Cadence remainder */
+	uint32_t 			cwr;				/* Card buffer offset of the next write */
+	uint64_t 			written;			/* Bytes committed by the producer */
+	uint64_t 			read;				/* Bytes taken from the host ring */
+	uint64_t 			silence;			/* Bytes of silence played */
+	uint64_t 			skipped;			/* Bytes skipped for bumped frames */
+	uint32_t 			underruns;			/* Times the card was padded with silence */
+	atomic_t 			hold;				/* Frames the video held, from the hard IRQ */
+	atomic_t 			skip;				/* Frames the video bumped over, from the hard IRQ */
+	aja_hostring_t 			ring;				/* Host ring */
+	aja_hostring_t 			zero;				/* A page of silence */
+} aja_afeed_t;
+
+#ifdef AJA_ALSA
+enum aja_pcm_state {
+	AJA_PcmStopped = 0,
+	AJA_PcmStarting,
+	AJA_PcmRunning,
+	AJA_PcmStopping
+};
+
+/* One direction of the ALSA PCM.  The trigger callback is atomic, so it only
+ * changes the state and the IRQ thread starts and stops the card */
+typedef struct {
+	struct snd_pcm_substream 	*substream;			/* Open substream */
+	volatile int 			state;				/* aja_pcm_state */
+	aja_hostring_t 			ring;				/* View of the ALSA buffer */
+	uint32_t 			pos;				/* Bytes into the ALSA buffer */
+	uint32_t 			cardpos;			/* Card buffer offset */
+	uint32_t 			period;				/* Bytes since the last period */
+} aja_pcmstream_t;
+
+typedef struct {
+	struct snd_card 		*card;				/* ALSA card */
+	struct snd_pcm 			*pcm;				/* The PCM device */
+	struct semaphore 		lock;				/* Buffers and transfers */
+	aja_pcmstream_t 		stream[2];			/* Indexed by SNDRV_PCM_STREAM_* */
+} aja_alsa_t;
+#endif
+
 typedef struct {
 	int64_t 			id; 				/* ID of the current frame */
 	wait_queue_head_t 		wait; 				/* Frame wait queue */
+	wait_queue_head_t 		until; 				/* Wait until frame queue (aja_frame_waiter_t) */
 	aja_frametime_t			time;				/* IRQ timing */
+	aja_frameclock_t 		*clock;				/* mmap'ed frame clock page */
 } aja_frameinfo_t;
 
+/* One frame of the card clock to system clock fit */
+typedef struct {
+	int64_t 			id;				/* Frame ID */
+	uint64_t 			count;				/* Extended 48KHz count */
+	int64_t 			mono;				/* System time (ns) */
+} aja_clocksample_t;
+
+typedef struct {
+	int 				head;				/* Next sample slot */
+	int 				samples;			/* Samples in the window */
+	aja_clocksample_t 		sample[AJA_CLOCKSYNC_SAMPLES];	/* Sample window */
+} aja_clockwin_t;
+
+#define AJA_CLOCKSYNC_DECIMATE 		16				/* Frames between counter fit samples */
+
+/* Card clock to system clock fit.  Written by the output IRQ only */
+typedef struct {
+	uint32_t 			timer;				/* Last 48KHz counter value, protected by spin_reg */
+	uint64_t 			count;				/* Extended 48KHz count, protected by spin_reg */
+	int64_t 			last;				/* Time of the last sample */
+	int 				decimate;			/* Frames until the next counter sample */
+	aja_clockwin_t 			frames;				/* Every frame, for the frame period */
+	aja_clockwin_t 			counter;			/* Every AJA_CLOCKSYNC_DECIMATE frames, for the drift */
+	aja_clocksync_t 		sync;				/* Latest fit, protected by spin_reg */
+} aja_clockfit_t;
+
 typedef struct {
 	atomic_t 			flags;				/* TCG flags */
 	volatile timecode_t 		value;				/* Current timecode generator value */
 } aja_tcg_t;
 
-/* This struct contains all the information for a card */
+enum aja_thread_flags {
+	AJA_ThreadFrame = 0						/* A new frame needs finishing */
+};
+
+/* Work handed from the hard IRQ to the IRQ thread.  Protected by spin_reg */
+typedef struct {
+	unsigned long 			pending;			/* AJA_Thread* bits */
+	int 				done[AJA_MAXPAGES];		/* Captured pages waiting for timecode */
+	int 				donect;				/* Number of pages in done */
+	unsigned int 			gen;				/* Bumped when a stream init empties done */
+	timecode_t 			tc;				/* Wire timecode of the current frame */
+	int64_t 			tstamp;				/* Time the hard IRQ finished (ns) */
+	aja_timing_t 			timing;				/* Handler timing statistics */
+} aja_irqthread_t;
+
+/* LTC generator upkeep.  The IRQ publishes the target through a two entry
+ * slot, seq selects the current entry and changes after every write */
+typedef struct {
+	struct workqueue_struct 	*wq;				/* LTC worker queue */
+	struct work_struct 		work;				/* Generator check work */
+	timecode_t 			slot[2];			/* Target timecode */
+	atomic_t 			seq;				/* Slot sequence */
+} aja_ltc_t;
+
+/* Register writes waiting for the next output vertical */
+typedef struct {
+	int 				count;				/* Number of queued writes */
+	aja_registerio_t 		regs[AJA_MAXREGV];		/* Queued writes */
+} aja_regqueue_t;
+
+struct aja_card_s;
+
+/* Board family operations.  Chosen once at probe, so the hot paths for a board
+ * only carry the code that board needs. */
 typedef struct {
+	const char 			*name;						/* Family name */
+	uint32_t 			(*irq_video)(struct aja_card_s *, uint32_t);	/* Handle the reg 21 IRQ sources, returns the reg 20 clear bits */
+	void 				(*dma_kick)(struct aja_card_s *, aja_dma_t *);	/* Load the first descriptor and start the engine */
+	void 				(*sdi_tc)(struct aja_card_s *, const timecode_t *);	/* Set the SDI output timecode */
+} aja_boardops_t;
+
+/* This struct contains all the information for a card */
+typedef struct aja_card_s {
 	int				index;						/* Card number in system */
 	int 				fwid;						/* Firmware ID number */
 	char 				name[16];					/* Name of the card device */
@@ -408,11 +650,13 @@ typedef struct {
 	volatile int 			flags;						/* Flags */
 	spinlock_t 			spin_reg;					/* Card register I/O spinlock */
 	aja_frameinfo_t 		frame;						/* Current frame information structure */
+	aja_clockfit_t 			clockfit;					/* Card clock to system clock fit */
 	aja_stream_t 			stream;						/* Stream structure */
 	aja_tcg_t 			tcg;						/* Timecode generator structure */
 	volatile int64_t 		irqcount[AJA_IRQ_TYPES];			/* An array of IRQ counts (one for every type of IRQ) */
 	wait_queue_head_t 		irqwait[AJA_IRQ_TYPES];				/* An array of IRQ wait queues (same as above) */
 	const aja_cardcap_t		*caps;						/* Capabilities of the board */
+	aja_boardops_t 			ops;						/* Board family operations */
 	void __iomem			*regadd;					/* Address of the remapped card register space */
 	size_t 				reglen;						/* Lenght (in bytes) of the card register space */
 	aja_dma_t 			dma[AJA_DMA_COUNT]; 				/* DMA management */
@@ -420,6 +664,16 @@ typedef struct {
 	struct p2slave_t		*p2slave;					/* P2 slave data */
 	pcitc_t				*pcitc;						/* LTC I/O device */
 	aja_audio_t			aplay;						/* Audio Playback Structure */
+	aja_acapring_t 			acapring;					/* Frame aligned audio capture */
+	aja_afeed_t 			afeed;						/* Audio playback feeder */
+	aja_avmon_t 			avmon;						/* A/V drift monitor */
+#ifdef AJA_ALSA
+	aja_alsa_t 			alsa;						/* ALSA PCM */
+#endif
+	aja_irqthread_t 		thread;						/* IRQ thread work */
+	aja_ltc_t 			ltc;						/* LTC generator worker */
+	uint32_t 			shadow[AJA_SHADOW_REGS];			/* Shadow copy of the driver owned register bits */
+	aja_regqueue_t 			regq;						/* Register writes for the next frame */
 } aja_card_t;
 
 
@@ -459,9 +713,232 @@ static int64_t aja_irqcount(aja_card_t *card, const int type) {
 	return card->irqcount[type];
 }
 
-static int aja_prset(aja_card_t *card, const aja_register_t preg, uint32_t value) {
+/* Register access trace.  Each CPU records into its own ring with interrupts
+ * off, so recording takes no locks.  A record is filled in before the ring head
+ * moves past it, and the reader drops anything that may have been overwritten
+ * while it was copying. */
+typedef struct {
+	unsigned int 		head;		/* Records ever written */
+	unsigned int 		start;		/* Head at the last clear */
+	aja_regtrace_t 		rec[AJA_REGTRACE_ENTRIES];
+} aja_regtrace_ring_t;
+
+static DEFINE_PER_CPU(aja_regtrace_ring_t *, aja_regtrace_ring);
+static struct dentry 		*aja_debugfs_dir = NULL;
+
+static void aja_regtrace_record(aja_card_t *card, int op, uint32_t add, uint32_t value, void *caller) {
+	aja_regtrace_ring_t *ring;
+	aja_regtrace_t *t;
+	unsigned long flags;
+	unsigned int h;
+
+	local_irq_save(flags);
+	ring = __get_cpu_var(aja_regtrace_ring);
+	if(ring) {
+		h = ring->head;
+		t = &ring->rec[h & (AJA_REGTRACE_ENTRIES - 1)];
+		t->tstamp = ktime_to_ns(ktime_get());
+		t->caller = (unsigned long)caller;
+		t->add = add;
+		t->value = value;
+		t->pid = current->pid;
+		t->op = op;
+		t->ctx = in_irq() ? AJA_TraceHardIRQ : (in_softirq() ? AJA_TraceSoftIRQ : AJA_TraceProcess);
+		t->card = card->index;
+		t->cpu = smp_processor_id();
+		smp_wmb();
+		ring->head = h + 1;
+	}
+	local_irq_restore(flags);
+	return;
+}
+
+/* Raw register accesses.  These are macros so the caller recorded is the function
+ * making the access.  'add' is the byte offset into the register space. */
+#define aja_ioread(card, add) ({ \
+	uint32_t __v = ioread32((card)->regadd + (add)); \
+	if(unlikely(regtrace)) aja_regtrace_record(card, AJA_TraceRead, add, __v, __builtin_return_address(0)); \
+	__v; })
+
+#define aja_iowrite(card, v, add) do { \
+	uint32_t __v = (v); \
+	iowrite32(__v, (card)->regadd + (add)); \
+	if(unlikely(regtrace)) aja_regtrace_record(card, AJA_TraceWrite, add, __v, __builtin_return_address(0)); \
+} while(0)
+
+typedef struct {
+	size_t 			len;
+	aja_regtrace_hdr_t 	hdr;
+	aja_regtrace_t 		rec[0];
+} aja_regtrace_snap_t;
+
+/* Snapshots every ring for the reader */
+static int aja_regtrace_open(struct inode *inode, struct file *file) {
+	aja_regtrace_snap_t *snap;
+	unsigned int head, end, first, i;
+	int cpu, count = 0;
+
+	snap = vmalloc(sizeof(*snap) + sizeof(aja_regtrace_t) * AJA_REGTRACE_ENTRIES * num_possible_cpus());
+	if(snap == NULL) return -ENOMEM;
+
+	for_each_possible_cpu(cpu) {
+		aja_regtrace_ring_t *ring = per_cpu(aja_regtrace_ring, cpu);
+		if(ring == NULL) continue;
+		head = ring->head;
+		smp_rmb();
+		first = ring->start;
+		if(head - first > AJA_REGTRACE_ENTRIES) first = head - AJA_REGTRACE_ENTRIES;
+		for(i = first; i != head; i++) snap->rec[count + i - first] = ring->rec[i & (AJA_REGTRACE_ENTRIES - 1)];
+
+		/* Anything at or below end - ENTRIES may have been rewritten during the copy */
+		smp_rmb();
+		end = ring->head;
+		if(end - first >= AJA_REGTRACE_ENTRIES) {
+			unsigned int drop = end - first - AJA_REGTRACE_ENTRIES + 1;
+			if(drop > head - first) drop = head - first;
+			memmove(&snap->rec[count], &snap->rec[count + drop], sizeof(aja_regtrace_t) * (head - first - drop));
+			first += drop;
+		}
+		count += head - first;
+	}
+
+	snap->hdr.magic = AJA_REGTRACE_MAGIC;
+	snap->hdr.version = AJA_REGTRACE_VERSION;
+	snap->hdr.size = sizeof(aja_regtrace_t);
+	snap->hdr.count = count;
+	snap->len = sizeof(aja_regtrace_hdr_t) + sizeof(aja_regtrace_t) * count;
+	file->private_data = snap;
+	return 0;
+}
+
+static ssize_t aja_regtrace_read(struct file *file, char __user *buf, size_t len, loff_t *off) {
+	aja_regtrace_snap_t *snap = file->private_data;
+	return simple_read_from_buffer(buf, len, off, &snap->hdr, snap->len);
+}
+
+/* Any write clears the trace */
+static ssize_t aja_regtrace_write(struct file *file, const char __user *buf, size_t len, loff_t *off) {
+	int cpu;
+	for_each_possible_cpu(cpu) {
+		aja_regtrace_ring_t *ring = per_cpu(aja_regtrace_ring, cpu);
+		if(ring) ring->start = ring->head;
+	}
+	return len;
+}
+
+static int aja_regtrace_release(struct inode *inode, struct file *file) {
+	vfree(file->private_data);
+	return 0;
+}
+
+static const struct file_operations aja_regtrace_fops = {
+	.owner = 	THIS_MODULE,
+	.open = 	aja_regtrace_open,
+	.read = 	aja_regtrace_read,
+	.write = 	aja_regtrace_write,
+	.release = 	aja_regtrace_release
+};
+
+static void aja_regtrace_cleanup(void) {
+	int cpu;
+	if(aja_debugfs_dir) {
+		debugfs_remove_recursive(aja_debugfs_dir);
+		aja_debugfs_dir = NULL;
+	}
+	for_each_possible_cpu(cpu) {
+		vfree(per_cpu(aja_regtrace_ring, cpu));
+		per_cpu(aja_regtrace_ring, cpu) = NULL;
+	}
+	return;
+}
+
+/* Allocates the trace rings and the debugfs file.  Tracing is turned back off if
+ * any of it fails */
+static void aja_regtrace_init(void) {
+	aja_regtrace_ring_t *ring;
+	struct dentry *d;
+	int cpu;
+
+	if(!regtrace) return;
+	for_each_possible_cpu(cpu) {
+		ring = vmalloc(sizeof(aja_regtrace_ring_t));
+		per_cpu(aja_regtrace_ring, cpu) = ring;
+		if(ring == NULL) goto regtracebail;
+		ring->head = 0;
+		ring->start = 0;
+	}
+
+	d = debugfs_create_dir("aja", NULL);
+	if(d == NULL || IS_ERR(d)) goto regtracebail;
+	aja_debugfs_dir = d;
+	d = debugfs_create_file("regtrace", S_IRUSR | S_IWUSR, aja_debugfs_dir, NULL, &aja_regtrace_fops);
+	if(d == NULL || IS_ERR(d)) goto regtracebail;
+
+	pinfo("Register trace enabled, %d records per CPU\n", AJA_REGTRACE_ENTRIES);
+	return;
+
+regtracebail:
+	perror("Unable to set up the register trace, tracing disabled\n");
+	regtrace = 0;
+	aja_regtrace_cleanup();
+	return;
+}
+
+/* Registers listed in aja_shadow.h are never read back for a field write.  The
+ * driver owned bits are kept in card->shadow and write only bits are written
+ * through without being kept. */
+#define IsShadowReg(n) 	((n) < AJA_SHADOW_REGS && aja_shadow_cached[n])
+
+/* Loads the shadow from the card.  Must be called before any shadowed register is
+ * written, and again whenever the card registers are reset (firmware load) */
+static void aja_shadow_seed(aja_card_t *card) {
 	unsigned long flags;
+	uint32_t n;
+
+	spin_lock_irqsave(&card->spin_reg, flags);
+	for(n = 0; n < AJA_SHADOW_REGS; n++) {
+		card->shadow[n] = 0;
+		if(!aja_shadow_cached[n]) continue;
+		if((card->caps->flags & AJA_SmallReg) && (n * 4 > 255)) continue;
+		if(n * 4 > card->reglen) continue;
+		card->shadow[n] = aja_ioread(card, n * 4) & aja_shadow_keep[n];
+	}
+	spin_unlock_irqrestore(&card->spin_reg, flags);
+	return;
+}
+
+/* Writes the masked bits of a register.  Must be called with spin_reg held */
+static inline void aja_prwrite_locked(aja_card_t *card, uint32_t add, uint32_t mask, uint32_t value) {
+	uint32_t n = add / 4;
 	uint32_t reg;
+
+	if(IsShadowReg(n)) {
+		reg = (card->shadow[n] & (~mask)) | (value & mask);
+		aja_iowrite(card, reg, add);
+		card->shadow[n] = reg & aja_shadow_keep[n];
+	} else {
+		reg = aja_ioread(card, add) & (~mask);
+		aja_iowrite(card, reg + (value & mask), add);
+	}
+	return;
+}
+
+/* Writes the masked bits of a register.  With constant arguments this folds down
+ * to the single write (or locked update) the register needs */
+static inline void aja_prwrite(aja_card_t *card, uint32_t add, uint32_t mask, uint32_t value) {
+	unsigned long flags;
+	// A whole register write needs no read, the lock is only for the shadow
+	if(mask == 0xFFFFFFFF && !IsShadowReg(add / 4)) {
+		aja_iowrite(card, value, add);
+		return;
+	}
+	spin_lock_irqsave(&card->spin_reg, flags);
+	aja_prwrite_locked(card, add, mask, value);
+	spin_unlock_irqrestore(&card->spin_reg, flags);
+	return;
+}
+
+static int aja_prset(aja_card_t *card, const aja_register_t preg, uint32_t value) {
 	
 	/* Silently fail if we are trying to write to a register that doesn't exist on an older card */
 	if(unlikely(((card->caps->flags & AJA_SmallReg) && (preg.add > 255)))) return 0;
@@ -471,16 +948,51 @@ static int aja_prset(aja_card_t *card, const aja_register_t preg, uint32_t value
 		return -1;
 	}
 	
-	if(preg.mask == 0xFFFFFFFF) {
-		iowrite32(value, card->regadd + preg.add);
-		return 0;
+	aja_prwrite(card, preg.add, preg.mask, value << preg.shift);
+	return 0;
+}
+
+/* Register transactions.  Field writes are gathered per register and flushed
+ * with a single write each on commit. */
+static void aja_regtx_begin(aja_regtx_t *tx) {
+	tx->count = 0;
+	return;
+}
+
+static int aja_regtx_set(aja_regtx_t *tx, const aja_register_t preg, uint32_t value) {
+	int i;
+	for(i = 0; i < tx->count; i++) if(tx->reg[i].add == preg.add) break;
+	if(i == tx->count) {
+		if(unlikely(i == AJA_REGTX_MAX)) {
+			perror("register transaction full, register %u dropped\n", preg.add / 4);
+			return -ENOSPC;
+		}
+		tx->reg[i].add = preg.add;
+		tx->reg[i].mask = 0;
+		tx->reg[i].value = 0;
+		tx->count++;
 	}
+	tx->reg[i].mask |= preg.mask;
+	tx->reg[i].value = (tx->reg[i].value & (~preg.mask)) | ((value << preg.shift) & preg.mask);
+	return 0;
+}
+
+static int aja_regtx_commit(aja_card_t *card, aja_regtx_t *tx) {
+	unsigned long flags;
+	int i;
 
 	spin_lock_irqsave(&card->spin_reg, flags);
-	reg = ioread32(card->regadd + preg.add) & (~preg.mask);
-	value = value << preg.shift;
-	iowrite32(reg + value, card->regadd + preg.add);
+	for(i = 0; i < tx->count; i++) {
+		uint32_t add = tx->reg[i].add;
+		if((card->caps->flags & AJA_SmallReg) && (add > 255)) continue;
+		if(unlikely(add > card->reglen)) {
+			perror("non-existant register: %u\n", add / 4);
+			continue;
+		}
+		aja_prwrite_locked(card, add, tx->reg[i].mask, tx->reg[i].value);
+	}
 	spin_unlock_irqrestore(&card->spin_reg, flags);
+	tx->count = 0;
 	return 0;
 }
 
@@ -492,9 +1004,18 @@ static uint32_t aja_prget(aja_card_t *card, const aja_register_t preg) {
 		return 0;
 	}
 
-	return (ioread32(card->regadd + preg.add) & preg.mask) >> preg.shift;
+	return (aja_ioread(card, preg.add) & preg.mask) >> preg.shift;
 }
 
+/* Constant folded per register accessors (ajareg_get_xxx/ajareg_set_xxx) for the
+ * hot paths.  There are no AJA_SmallReg or reglen checks, so registers past the
+ * small register space need the _small variants on those boards. */
+#define AJA_REGCTX aja_card_t *
+#define AJA_REGREAD(c, add) aja_ioread(c, add)
+#define AJA_REGWRITE(c, add, v) aja_prwrite(c, add, 0xFFFFFFFF, v)
+#define AJA_REGUPDATE(c, add, mask, v) aja_prwrite(c, add, mask, v)
+#include <aja_regaccess.h>
+
 /* Benchmark functions */
 static void aja_benchmark_start(aja_card_t *card, aja_benchmark_t *bm) {
 	bm->start = aja_prget(card, ajareg_audiocount);
@@ -507,29 +1028,31 @@ static void aja_benchmark_stop(aja_card_t *card, aja_benchmark_t *bm) {
 }
 
 static int aja_irqset(aja_card_t *card, int val) {
+	aja_regtx_t tx;
 	pdebug("card %d: settings interrupts %d\n", card->index, val);
+	aja_regtx_begin(&tx);
 	// If we are disabling interrupts, make sure any running DMAs have been stopped.
 	if(!val) {
-		aja_prset(card, ajareg_dma1go, 0);
-		aja_prset(card, ajareg_dma2go, 0);
-		aja_prset(card, ajareg_dma3go, 0);
-	}
-	aja_prset(card, ajareg_buserrorirqenable, val);
-	aja_prset(card, ajareg_dma1irqenable, val);
-	aja_prset(card, ajareg_dma2irqenable, val);
-	aja_prset(card, ajareg_dma3irqenable, val);
-	aja_prset(card, ajareg_outputirqenable, val);
-	aja_prset(card, ajareg_input1irqenable, val);
-	aja_prset(card, ajareg_input2irqenable, val);
-	aja_prset(card, ajareg_audiowrapirqenable, val);
+		aja_regtx_set(&tx, ajareg_dma1go, 0);
+		aja_regtx_set(&tx, ajareg_dma2go, 0);
+		aja_regtx_set(&tx, ajareg_dma3go, 0);
+	}
+	aja_regtx_set(&tx, ajareg_buserrorirqenable, val);
+	aja_regtx_set(&tx, ajareg_dma1irqenable, val);
+	aja_regtx_set(&tx, ajareg_dma2irqenable, val);
+	aja_regtx_set(&tx, ajareg_dma3irqenable, val);
+	aja_regtx_set(&tx, ajareg_outputirqenable, val);
+	aja_regtx_set(&tx, ajareg_input1irqenable, val);
+	aja_regtx_set(&tx, ajareg_input2irqenable, val);
+	aja_regtx_set(&tx, ajareg_audiowrapirqenable, val);
 
 	if(card->caps->flags & AJA_HasSerial) {
-		aja_prset(card, ajareg_uarttxirqenable, val);
-		aja_prset(card, ajareg_uartrxirqenable, val);
-		aja_prset(card, ajareg_uartenabletx, val);
-		aja_prset(card, ajareg_uartenablerx, val);
+		aja_regtx_set(&tx, ajareg_uarttxirqenable, val);
+		aja_regtx_set(&tx, ajareg_uartrxirqenable, val);
+		aja_regtx_set(&tx, ajareg_uartenabletx, val);
+		aja_regtx_set(&tx, ajareg_uartenablerx, val);
 	}
-	return 0;
+	return aja_regtx_commit(card, &tx);
 }
 
 static aja_audio_position_t aja_aplay_position(aja_card_t *card) {
@@ -541,14 +1064,14 @@ static aja_audio_position_t aja_aplay_position(aja_card_t *card) {
 
 /* Function starts the audio playback */
 static int aja_aplay_start(aja_card_t *card) {
-	aja_prset(card, ajareg_aplayreset, 1);
-	aja_prset(card, ajareg_aplayreset, 0);
+	ajareg_set_aplayreset(card, 1);
+	ajareg_set_aplayreset(card, 0);
 	return 0;
 }
 
 /* Function stops the audio playback */
 static int aja_aplay_stop(aja_card_t *card) {
-	aja_prset(card, ajareg_aplayreset, 1);
+	ajareg_set_aplayreset(card, 1);
 	return 0;
 }
 
@@ -577,6 +1100,63 @@ static int aja_acap_stop(aja_card_t *card) {
 	return 0;
 }
 
+/* Samples per frame as num / den for each ajareg_framerate code */
+static const uint32_t aja_acap_cadence[8][2] = {
+	{ 0, 0 },
+	{ AJA_AUDIO_RATE, 60 },			/* 60 */
+	{ AJA_AUDIO_RATE * 1001, 60000 },	/* 59.94, 800.8 */
+	{ AJA_AUDIO_RATE, 30 },			/* 30 */
+	{ AJA_AUDIO_RATE * 1001, 30000 },	/* 29.97, 1601.6 */
+	{ AJA_AUDIO_RATE, 25 },			/* 25 */
+	{ AJA_AUDIO_RATE, 24 },			/* 24 */
+	{ AJA_AUDIO_RATE * 1001, 24000 }		/* 23.976 */
+};
+
+/* Starts the slices at 'pos' in the card buffer */
+static void aja_acapring_anchor(aja_acapring_t *ar, uint32_t pos) {
+	ar->pos = pos;
+	ar->acc = 0;
+	ar->valid = 1;
+	return;
+}
+
+/* Cuts the audio captured during the last frame out of the card buffer.  'aptr' is
+ * the card capture pointer at the start of this frame.  Returns the slice length
+ * and its card offset in *cardoff.  Sets *reset if the card pointer had moved away
+ * from the slices, in which case the slice is taken to end at the card pointer */
+static uint32_t aja_acap_slice(aja_card_t *card, uint32_t aptr, uint32_t *cardoff, int *reset) {
+	aja_acapring_t 	*ar = &card->acapring;
+	uint32_t 	size = AJA_ACAP_CARDSIZE;
+	uint32_t 	n, len, d;
+
+	aptr %= size;
+	aptr -= aptr % ar->fbytes;
+
+	if(ar->den) {
+		ar->acc += ar->num;
+		n = ar->acc / ar->den;
+		ar->acc -= n * ar->den;
+		len = n * ar->fbytes;
+	} else {
+		len = ar->valid ? (aptr + size - ar->pos) % size : 0;
+	}
+
+	// The card should be within half a slice of the end of this one.  A capture
+	// that was already running when we joined ends at the card pointer too.
+	*reset = 0;
+	d = (aptr + size - (ar->pos + len) % size) % size;
+	card->avmon.skew = (int32_t)(d < size / 2 ? d : d - size) / (int32_t)ar->fbytes;
+	if(!ar->valid || (d > len / 2 && d < size - len / 2)) {
+		*reset = ar->valid;
+		aja_acapring_anchor(ar, (aptr + size - len) % size);
+	}
+
+	*cardoff = ar->pos;
+	ar->pos = (ar->pos + len) % size;
+	if(len > ar->slotsize) len = ar->slotsize;
+	return len;
+}
+
 /*****************************************************************************/
 /* TIMECODE                                                                  */
 /*****************************************************************************/
@@ -599,13 +1179,6 @@ static int aja_timecode_getfps(aja_card_t *card) {
 	return 0;
 }
 
-static int aja_timecode_set_sdi1(aja_card_t *card, const timecode_t *tc) {
-	timecode_rp188_t rp = timecode_to_rp188(tc);
-	aja_prset(card, ajareg_ch1rp188_1, rp.d1);
-	aja_prset(card, ajareg_ch1rp188_2, rp.d2);
-	return 0;
-}
-
 static int aja_timecode_get_sdi1(aja_card_t *card, timecode_t *tc) {
 	timecode_rp188_t rp;
 	rp.d1 = aja_prget(card, ajareg_ch1rp188_1);
@@ -615,13 +1188,6 @@ static int aja_timecode_get_sdi1(aja_card_t *card, timecode_t *tc) {
 	return 0;
 }
 
-static int aja_timecode_set_sdi2(aja_card_t *card, const timecode_t *tc) {
-	timecode_rp188_t rp = timecode_to_rp188(tc);
-	aja_prset(card, ajareg_ch2rp188_1, rp.d1);
-	aja_prset(card, ajareg_ch2rp188_2, rp.d2);
-	return 0;
-}
-
 static int aja_timecode_get_sdi2(aja_card_t *card, timecode_t *tc) {
 	timecode_rp188_t rp;
 	rp.d1 = aja_prget(card, ajareg_ch2rp188_1);
@@ -631,6 +1197,24 @@ static int aja_timecode_get_sdi2(aja_card_t *card, timecode_t *tc) {
 	return 0;
 }
 
+/* Output timecode for both SDI channels */
+static void aja_timecode_set_sdi(aja_card_t *card, const timecode_t *tc) {
+	timecode_rp188_t rp = timecode_to_rp188(tc);
+	ajareg_set_ch1rp188_1(card, rp.d1);
+	ajareg_set_ch1rp188_2(card, rp.d2);
+	ajareg_set_ch2rp188_1(card, rp.d1);
+	ajareg_set_ch2rp188_2(card, rp.d2);
+	return;
+}
+
+/* Small register boards don't have the channel 2 RP188 registers */
+static void aja_timecode_set_sdi_small(aja_card_t *card, const timecode_t *tc) {
+	timecode_rp188_t rp = timecode_to_rp188(tc);
+	ajareg_set_ch1rp188_1_small(card, rp.d1);
+	ajareg_set_ch1rp188_2_small(card, rp.d2);
+	return;
+}
+
 static void aja_timecode_set_ltc(aja_card_t *card, const timecode_t *ntc) {
 	timecode_t tc;
 	if(!card->pcitc) return;
@@ -646,6 +1230,35 @@ static void aja_timecode_set_ltc(aja_card_t *card, const timecode_t *ntc) {
 	return;
 }
 
+/* Worker that keeps the LTC generator on the target timecode.  The mailbox
+ * round trips can take milliseconds, so this never runs in the IRQ */
+static WORK_FUNC(aja_timecode_ltc_work, w) {
+	aja_card_t 	*card = container_of((struct work_struct *)w, aja_card_t, ltc.work);
+	timecode_t 	tc;
+	int 		seq;
+
+	do {
+		seq = atomic_read(&card->ltc.seq);
+		smp_rmb();
+		tc = card->ltc.slot[seq & 1];
+		smp_rmb();
+	} while(seq != atomic_read(&card->ltc.seq));
+
+	aja_timecode_set_ltc(card, &tc);
+	return;
+}
+
+/* Hands the LTC generator target to the worker.  Safe to call from the IRQ */
+static void aja_timecode_queue_ltc(aja_card_t *card, const timecode_t *tc) {
+	int seq = atomic_read(&card->ltc.seq) + 1;
+	if(!card->ltc.wq) return;
+	card->ltc.slot[seq & 1] = *tc;
+	smp_wmb();
+	atomic_set(&card->ltc.seq, seq);
+	queue_work(card->ltc.wq, &card->ltc.work);
+	return;
+}
+
 static int aja_timecode_get_ltc(aja_card_t *card, timecode_t *tc) {
 	if(card->pcitc) return pcitc.readtc(card->pcitc, tc);
 	timecode_init(tc);
@@ -738,6 +1351,233 @@ static ssize_t aja_show_tcg(struct class_device *cls, char *buf) {
 CLASS_DEVICE_ATTR(tcg, 0444, aja_show_tcg, NULL);
 */
 
+/* The audio engine is kept from user transfers while any audio ring is set up,
+ * or the IRQ thread would wait behind them every frame */
+static int aja_audio_dma_reserved(aja_card_t *card) {
+	if(card->acapring.ring.npages || card->afeed.ring.npages) return 1;
+#ifdef AJA_ALSA
+	if(card->alsa.stream[0].ring.npages || card->alsa.stream[1].ring.npages) return 1;
+#endif
+	return 0;
+}
+
+/* Waits out a user transfer that took the audio engine before its ring was set up */
+static void aja_audio_dma_claim(aja_card_t *card) {
+	down(&card->dma[AJA_AUDIO_DMA].mutex);
+	up(&card->dma[AJA_AUDIO_DMA].mutex);
+	return;
+}
+
+/* Frees a host ring.  Pages that are still mapped by a process stay around until
+ * it unmaps them */
+static void aja_hostring_free(aja_card_t *card, aja_hostring_t *hr) {
+	int 		i;
+
+	for(i = 0; i < hr->npages && !hr->coherent; i++) {
+		pci_unmap_page(card->pcidev, hr->bus[i], PAGE_SIZE, hr->dir);
+		__free_page(hr->pages[i]);
+	}
+	if(hr->pages) kfree(hr->pages);
+	if(hr->bus) kfree(hr->bus);
+	hr->pages = NULL;
+	hr->bus = NULL;
+	hr->npages = 0;
+	hr->coherent = 0;
+	return;
+}
+
+/* Allocates a host ring of 'npages' zeroed pages, mapped for 'dir' DMA */
+static int aja_hostring_alloc(aja_card_t *card, aja_hostring_t *hr, int npages, int dir) {
+	struct page 	*p;
+
+	hr->dir = dir;
+	hr->coherent = 0;
+	hr->pages = kmalloc(npages * sizeof(struct page *), GFP_KERNEL);
+	hr->bus = kmalloc(npages * sizeof(dma_addr_t), GFP_KERNEL);
+	if(hr->pages == NULL || hr->bus == NULL) goto alloc_fail;
+
+	for(hr->npages = 0; hr->npages < npages; hr->npages++) {
+		p = alloc_page(GFP_KERNEL | __GFP_ZERO);
+		if(p == NULL) goto alloc_fail;
+		hr->pages[hr->npages] = p;
+		hr->bus[hr->npages] = pci_map_page(card->pcidev, p, 0, PAGE_SIZE, dir);
+	}
+	return 0;
+
+alloc_fail:
+	perror("Audio ring: couldn't allocate %d pages\n", npages);
+	aja_hostring_free(card, hr);
+	return -ENOMEM;
+}
+
+/* Points a host ring at 'bytes' (whole pages) of coherent memory at 'addr', so
+ * the ring DMA helpers can work on buffers allocated elsewhere.  No page syncs
+ * are done and the memory isn't freed with the ring */
+static int aja_hostring_view(aja_hostring_t *hr, dma_addr_t addr, size_t bytes, int dir) {
+	int 		i;
+
+	hr->dir = dir;
+	hr->coherent = 1;
+	hr->pages = NULL;
+	hr->bus = kmalloc((bytes >> PAGE_SHIFT) * sizeof(dma_addr_t), GFP_KERNEL);
+	if(hr->bus == NULL) return -ENOMEM;
+	for(i = 0; i < (bytes >> PAGE_SHIFT); i++) hr->bus[i] = addr + ((dma_addr_t)i << PAGE_SHIFT);
+	hr->npages = i;
+	return 0;
+}
+
+/* Maps a host ring into a process, read only unless 'writable' */
+static int aja_hostring_mmap(aja_hostring_t *hr, struct vm_area_struct *vma, int writable) {
+	unsigned long 	i, size = vma->vm_end - vma->vm_start;
+	int 		ret = 0;
+
+	if(!writable) {
+		if(vma->vm_flags & VM_WRITE) return -EPERM;
+		vma->vm_flags &= ~VM_MAYWRITE;
+	}
+	if(size > ((unsigned long)hr->npages << PAGE_SHIFT)) return -EINVAL;
+	for(i = 0; !ret && i < (size >> PAGE_SHIFT); i++) {
+		ret = vm_insert_page(vma, vma->vm_start + (i << PAGE_SHIFT), hr->pages[i]);
+	}
+	return ret;
+}
+
+/* Number of audio channels the card is set up for */
+static int aja_audio_channels(aja_card_t *card) {
+	if(aja_prget(card, ajareg_audio16chan)) return 16;
+	if(aja_prget(card, ajareg_audio8chan)) return 8;
+	return 6;
+}
+
+#ifdef AJA_AUDIO_RINGS
+/* Sets up the captured audio ring for a stream of 'pagect' pages, from the current
+ * channel count and frame rate */
+static int aja_acapring_setup(aja_card_t *card, int pagect) {
+	aja_acapring_t 	*ar = &card->acapring;
+	uint32_t 	rate = aja_prget(card, ajareg_framerate) & 7;
+	int 		npages, ret = 0;
+
+	down(&ar->lock);
+	ar->due = 0;
+	ar->valid = 0;
+	ar->channels = aja_audio_channels(card);
+	ar->fbytes = ar->channels * AJA_AUDIO_SAMPLEBYTES;
+	ar->num = aja_acap_cadence[rate][0];
+	ar->den = aja_acap_cadence[rate][1];
+	ar->slotsize = PAGE_ALIGN(AJA_ACAP_MAXSAMPLES * ar->fbytes);
+
+	npages = (ar->slotsize >> PAGE_SHIFT) * pagect;
+	if(ar->ring.pages && ar->ring.npages != npages) aja_hostring_free(card, &ar->ring);
+	if(ar->ring.pages == NULL) ret = aja_hostring_alloc(card, &ar->ring, npages, PCI_DMA_FROMDEVICE);
+	if(!ret) aja_audio_dma_claim(card);
+	up(&ar->lock);
+
+	pdebug("Audio ring: %d channels, %u byte slots, %d pages, cadence %u/%u\n",
+		ar->channels, ar->slotsize, ar->ring.npages, ar->num, ar->den);
+	return ret;
+}
+#endif
+
+/*****************************************************************************/
+/* A/V DRIFT                                                                 */
+/*****************************************************************************/
+
+#define AJA_AVDRIFT_US(s) 	((s) * 125 / 6)		/* 48KHz samples to us */
+
+/* Takes the frame rate and channel count for the drift monitor and starts over */
+static void aja_avmon_setup(aja_card_t *card) {
+	aja_avmon_t 	*m = &card->avmon;
+	uint32_t 	rate = aja_prget(card, ajareg_framerate) & 7;
+	uint32_t 	fbytes = aja_audio_channels(card) * AJA_AUDIO_SAMPLEBYTES;
+	unsigned long 	flags;
+
+	spin_lock_irqsave(&card->spin_reg, flags);
+	memset(m, 0, sizeof(*m));
+	m->num = aja_acap_cadence[rate][0];
+	m->den = aja_acap_cadence[rate][1];
+	m->fbytes = fbytes;
+	m->limit = avdrift > 0 ? avdrift * (AJA_AUDIO_RATE / 1000) / 1000 : 0;
+	spin_unlock_irqrestore(&card->spin_reg, flags);
+	return;
+}
+
+/* Follows a card audio pointer over one frame.  Returns the drift in samples */
+static int32_t aja_avptr_update(aja_avmon_t *m, aja_avptr_t *p, uint32_t ptr, uint32_t size) {
+	uint32_t d, n;
+
+	ptr %= size;
+	d = (ptr + size - p->last) % size;
+	p->last = ptr;
+
+	// A pointer that stood still isn't running, one that moved more than two
+	// frames of audio was reset.  Either way start again from here.
+	if(!p->valid || !d || d > 2 * (m->num / m->den + 1) * m->fbytes) {
+		if(p->valid && d) m->resets++;
+		p->valid = (d != 0);
+		p->rem = p->acc = p->frames = 0;
+		p->samples = p->expect = 0;
+		return 0;
+	}
+
+	p->rem += d;
+	n = p->rem / m->fbytes;
+	p->rem -= n * m->fbytes;
+	p->samples += n;
+
+	p->acc += m->num;
+	n = p->acc / m->den;
+	p->acc -= n * m->den;
+	p->expect += n;
+
+	p->frames++;
+	return (int32_t)(p->samples - p->expect);
+}
+
+/* Is anything playing audio that should follow the video */
+static int aja_avmon_playing(aja_card_t *card) {
+	if(atomic_read(&card->stream.running) && (card->stream.flags & AJA_Playback)) return 1;
+	if(card->afeed.running) return 1;
+#ifdef AJA_ALSA
+	if(card->alsa.stream[SNDRV_PCM_STREAM_PLAYBACK].state == AJA_PcmRunning) return 1;
+#endif
+	return 0;
+}
+
+/* Updates the drift monitor at the start of a frame from the capture pointer
+ * 'aptr' and, if 'play' is set, the playback pointer 'pptr'.  Returns the capture
+ * drift in us and sets *event when the drift crosses the limit */
+static int32_t aja_avmon_update(aja_card_t *card, uint32_t aptr, int play, uint32_t pptr, int *event) {
+	aja_avmon_t 	*m = &card->avmon;
+	int32_t 	cd = 0, pd = 0, worst;
+	unsigned long 	flags;
+
+	*event = 0;
+	spin_lock_irqsave(&card->spin_reg, flags);
+	if(unlikely(!m->den)) {
+		spin_unlock_irqrestore(&card->spin_reg, flags);
+		return 0;
+	}
+	cd = aja_avptr_update(m, &m->cap, aptr, AJA_ACAP_CARDSIZE);
+	if(play) pd = aja_avptr_update(m, &m->play, pptr, AJA_APLAY_CARDSIZE);
+	else m->play.valid = 0;
+
+	worst = MAX(abs(cd), abs(pd));
+	if(worst > m->worst) m->worst = worst;
+	if(m->limit && !m->over && worst > m->limit) {
+		m->over = 1;
+		m->events++;
+		m->event_id = card->frame.id;
+		*event = 1;
+	} else if(m->over && worst < m->limit / 2) {
+		m->over = 0;
+	}
+	spin_unlock_irqrestore(&card->spin_reg, flags);
+
+	if(*event) pinfo("%s: audio drifted from the video, capture %d us, playback %d us\n",
+		card->name, AJA_AVDRIFT_US(cd), AJA_AVDRIFT_US(pd));
+	return AJA_AVDRIFT_US(cd);
+}
+
 /* Creates a new cardinfo structure */
 static aja_card_t *aja_card_create(struct pci_dev *pcidev, uint32_t id, int index) {
 	int i;
@@ -751,6 +1591,7 @@ static aja_card_t *aja_card_create(struct pci_dev *pcidev, uint32_t id, int inde
 	pci_set_drvdata(pcidev, (void *)card);
 	card->pcidev = pcidev;
 	spin_lock_init(&card->spin_reg);
+	spin_lock_init(&card->slavepkt.lock);
 
 	/* Card data */
 	card->index = index;
@@ -760,6 +1601,17 @@ static aja_card_t *aja_card_create(struct pci_dev *pcidev, uint32_t id, int inde
 
 	/* Intialize the frame count system */
 	init_waitqueue_head(&card->frame.wait);
+	init_waitqueue_head(&card->frame.until);
+	card->frame.clock = (aja_frameclock_t *)get_zeroed_page(GFP_KERNEL);
+	if(card->frame.clock) {
+		SetPageReserved(virt_to_page(card->frame.clock));
+	} else {
+		perror("%s: couldn't allocate the frame clock page\n", pciname);
+	}
+
+	/* Audio rings, allocated by the first AJA_CaptureAudio stream and AJACTL_AFEED_INIT */
+	init_MUTEX(&card->acapring.lock);
+	init_MUTEX(&card->afeed.lock);
 
 	/* IRQ wait queues */
 	for(i = 0; i < AJA_IRQ_TYPES; i++) {
@@ -841,6 +1693,15 @@ static void aja_card_free(aja_card_t *card) {
 
 	if(unlikely(card == NULL)) return;
 
+	if(card->frame.clock) {
+		ClearPageReserved(virt_to_page(card->frame.clock));
+		free_page((unsigned long)card->frame.clock);
+	}
+
+	aja_hostring_free(card, &card->acapring.ring);
+	aja_hostring_free(card, &card->afeed.ring);
+	aja_hostring_free(card, &card->afeed.zero);
+
 	/* DMA engines */
 	for(i = 0; i < AJA_DMA_COUNT; i++) {
 		dma = &card->dma[i];
@@ -1030,12 +1891,37 @@ static void aja_dma_cleanup(aja_card_t *card, aja_dma_t *dma) {
 	return;
 }
 
+/* Writes a register field without the aja_prset() checks, the DMA registers
+ * exist on every board */
+#define aja_dma_prset(card, reg, v) 	aja_prwrite(card, (reg).add, (reg).mask, (v) << (reg).shift)
+
+static void aja_dma_kick32(aja_card_t *card, aja_dma_t *dma) {
+	aja_dma_prset(card, dma->reg_hadd, dma->list[0].hadd);
+	aja_dma_prset(card, dma->reg_cadd, dma->list[0].cadd);
+	aja_dma_prset(card, dma->reg_count, dma->list[0].count);
+	aja_dma_prset(card, dma->reg_next, dma->list[0].next);
+	aja_dma_prset(card, dma->reg_dmago, 1);
+	return;
+}
+
+static void aja_dma_kick64(aja_card_t *card, aja_dma_t *dma) {
+	aja_dma_prset(card, dma->reg_hadd, dma->list[0].hadd);
+	aja_dma_prset(card, dma->reg_cadd, dma->list[0].cadd);
+	aja_dma_prset(card, dma->reg_count, dma->list[0].count);
+	aja_dma_prset(card, dma->reg_next, dma->list[0].next);
+	aja_dma_prset(card, dma->reg_hadd_high, dma->list[0].hadd_high);
+	aja_dma_prset(card, dma->reg_next_high, dma->list[0].next_high);
+	aja_dma_prset(card, dma->reg_dmago, 1);
+	return;
+}
+
 static int aja_dma(aja_card_t *card, aja_dmainfo_t *dmainfo) {
 	int 			i, ret = 0;
 	aja_dma_t 		*dma = NULL;
 
 	/* Try to get a DMA engine */
 	for(i = 0; i < AJA_DMA_COUNT; i++) {
+		if(i == AJA_AUDIO_DMA && aja_audio_dma_reserved(card)) continue;
 		if(!down_trylock(&card->dma[i].mutex)) {
 			dma = &card->dma[i];
 			break;
@@ -1054,16 +1940,8 @@ static int aja_dma(aja_card_t *card, aja_dmainfo_t *dmainfo) {
 	/* Start the benchmark */
 	aja_benchmark_start(card, &dma->bench.xfer);
 
-	/* Load the initial dma vector onto the card */
-	aja_prset(card, dma->reg_hadd, dma->list[0].hadd);
-	aja_prset(card, dma->reg_cadd, dma->list[0].cadd);
-	aja_prset(card, dma->reg_count, dma->list[0].count);
-	aja_prset(card, dma->reg_next, dma->list[0].next);
-	if(card->flags & AJA_DMA64) {
-		aja_prset(card, dma->reg_hadd_high, dma->list[0].hadd_high);
-		aja_prset(card, dma->reg_next_high, dma->list[0].next_high);
-	}
-	aja_prset(card, dma->reg_dmago, 1);
+	/* Load the initial dma vector onto the card and go */
+	card->ops.dma_kick(card, dma);
 
 	/* Start the DMA and block until we get word that the DMA has finished */
 	if(!wait_event_interruptible_timeout(card->irqwait[dma->irq], (!aja_prget(card, dma->reg_dmago)), 1000)) {
@@ -1085,30 +1963,221 @@ dma_fail1:
 
 }
 
-static int aja_firmware_ready_wait(aja_card_t *card) {
-	void __iomem *preg = card->regadd + 0x44;
-	int i;
-	// Waiting for program/ready bit to clear
-	for(i = 0; i < AJA_FIRMWARE_TIMEOUT; i++) {
-		if(!(ioread32(preg) & 0x100)) break;
-		mdelay(1);
+/* Takes the DMA engine and 'lock' for an audio transfer.  Audio runs in the IRQ
+ * thread, or in the hard IRQ on kernels without threaded IRQs, where we can only
+ * try for them */
+static int aja_hostring_lock(struct semaphore *lock, aja_dma_t *dma, int atomic) {
+	if(atomic) {
+		if(down_trylock(lock)) return -EBUSY;
+		if(down_trylock(&dma->mutex)) {
+			up(lock);
+			return -EBUSY;
+		}
+	} else {
+		down(lock);
+		down(&dma->mutex);
 	}
-	if(i == AJA_FIRMWARE_TIMEOUT) return 1;
 	return 0;
 }
 
-static int aja_firmware_done_wait(aja_card_t *card) {
-	void __iomem *preg = card->regadd + 0x44;
-	int i;
-	// Waiting for done bit to go high
+static void aja_hostring_unlock(struct semaphore *lock, aja_dma_t *dma) {
+	up(&dma->mutex);
+	up(lock);
+	return;
+}
+
+/* Adds descriptors moving 'len' bytes between host ring offset 'hoff' and offset
+ * *coff of the 'csize' byte card buffer at 'cbuf'.  Both sides wrap.  Returns the
+ * next free descriptor, or NULL if the list is full */
+static aja_sglist_t *aja_hostring_sg(aja_card_t *card, aja_dma_t *dma, aja_sglist_t *list,
+		const aja_hostring_t *hr, unsigned long hoff, uint32_t cbuf, uint32_t csize, uint32_t *coff, uint32_t len) {
+	unsigned long 	hsize = (unsigned long)hr->npages << PAGE_SHIFT;
+	uint32_t 	tcm = hr->dir == PCI_DMA_FROMDEVICE ? 0x80000000 : 0x00000000;
+	dma_addr_t 	addr, next;
+	uint32_t 	n;
+	int 		pg;
+	if(card->flags & AJA_DMA64) tcm |= 0x10000000;
+
+	hoff %= hsize;
+	while(len) {
+		if(list - dma->list >= max_dmalist) return NULL;
+		pg = hoff >> PAGE_SHIFT;
+		addr = hr->bus[pg] + (hoff & ~PAGE_MASK);
+		next = dma->list_pac + (list + 1 - dma->list) * sizeof(aja_sglist_t);
+		n = min_t(uint32_t, len, PAGE_SIZE - (hoff & ~PAGE_MASK));
+		n = min_t(uint32_t, n, csize - *coff);
+		if(!hr->coherent) pci_dma_sync_single_for_device(card->pcidev, hr->bus[pg], PAGE_SIZE, hr->dir);
+
+		list->hadd = addr;
+		list->cadd = cbuf + *coff;
+		list->count = (n / 4) | tcm;
+		list->next = next;
+		list->hadd_high = (uint64_t)addr >> 32;
+		list->next_high = (uint64_t)next >> 32;
+		list++;
+
+		hoff = (hoff + n) % hsize;
+		*coff = (*coff + n) % csize;
+		len -= n;
+	}
+	return list;
+}
+
+/* Ends the descriptor list at 'end', runs it and waits for the engine */
+static int aja_hostring_run(aja_card_t *card, aja_dma_t *dma, aja_sglist_t *end, int atomic) {
+	int 		done;
+
+	if(end == dma->list) return 0;
+	end[-1].next = 0;
+	end[-1].next_high = 0;
+
+	// Never busy wait a transfer out in the hard IRQ, see AJA_AUDIO_RINGS
+	if(atomic) return -EOPNOTSUPP;
+
+	card->ops.dma_kick(card, dma);
+	done = wait_event_timeout(card->irqwait[dma->irq], !aja_prget(card, dma->reg_dmago), HZ / 10);
+	if(!done) {
+		aja_prset(card, dma->reg_dmago, 0);
+		perror("DMA %d: audio transfer timed out\n", dma->engine);
+		return -ETIMEDOUT;
+	}
+	return 0;
+}
+
+/* DMAs page 'pg's slice of the card audio buffer into its slot of the ring */
+static int aja_acap_dma(aja_card_t *card, int pg, uint32_t len) {
+	aja_acapring_t 	*ar = &card->acapring;
+	aja_dma_t 	*dma = &card->dma[AJA_AUDIO_DMA];
+	aja_sglist_t 	*end;
+	uint32_t 	cardoff = ar->cardoff[pg];
+	unsigned long 	hoff = pg * ar->slotsize;
+	int 		i, ret, atomic = in_interrupt();
+
+	ret = aja_hostring_lock(&ar->lock, dma, atomic);
+	if(ret) return ret;
+
+	if(!ar->ring.pages || !dma->list || hoff + len > ((unsigned long)ar->ring.npages << PAGE_SHIFT)) {
+		ret = -ENOMEM;
+	} else {
+		end = aja_hostring_sg(card, dma, dma->list, &ar->ring, hoff, card->caps->acapbuf, AJA_ACAP_CARDSIZE, &cardoff, len);
+		ret = end ? aja_hostring_run(card, dma, end, atomic) : -ENOMEM;
+		for(i = hoff >> PAGE_SHIFT; i <= (hoff + len - 1) >> PAGE_SHIFT; i++) {
+			pci_dma_sync_single_for_cpu(card->pcidev, ar->ring.bus[i], PAGE_SIZE, PCI_DMA_FROMDEVICE);
+		}
+	}
+
+	aja_hostring_unlock(&ar->lock, dma);
+	return ret;
+}
+
+/* Bytes in the next 'frames' frames of the feeder's sample cadence */
+static uint32_t aja_afeed_framebytes(aja_afeed_t *af, uint32_t frames) {
+	uint32_t n = 0;
+	for(; frames; frames--) {
+		af->acc += af->num;
+		n += af->acc / af->den;
+		af->acc -= (af->acc / af->den) * af->den;
+	}
+	return n * af->fbytes;
+}
+
+/* Tops up the card playback buffer.  Called with the feeder lock and DMA engine held */
+static int aja_afeed_fill(aja_card_t *card, aja_dma_t *dma, int atomic) {
+	aja_afeed_t 	*af = &card->afeed;
+	uint32_t 	csize = AJA_APLAY_CARDSIZE;
+	int 		playing = !aja_prget(card, ajareg_aplayreset);
+	uint32_t 	rd = playing ? aja_prget(card, ajareg_aplaylast) % csize : 0;
+	uint32_t 	level = (af->cwr + csize - rd) % csize;
+	uint32_t 	frame = (af->num + af->den - 1) / af->den * af->fbytes;
+	uint32_t 	hold = atomic_xchg(&af->hold, 0);
+	uint32_t 	skip = atomic_xchg(&af->skip, 0);
+	uint32_t 	avail, sil = 0, data = 0, pad = 0, need = 0, n;
+	uint32_t 	coff = af->cwr;
+	aja_sglist_t 	*end = dma->list;
+	int 		ret;
+
+	avail = (uint32_t)(af->written - af->read);
+	avail -= avail % af->fbytes;
+
+	// Frames the video bumped over skip their audio, held frames play silence
+	if(skip) {
+		n = min_t(uint32_t, avail, aja_afeed_framebytes(af, skip));
+		af->read += n;
+		af->skipped += n;
+		avail -= n;
+	}
+	if(hold) sil = min_t(uint32_t, aja_afeed_framebytes(af, hold), csize / 4);
+
+	if(level < af->watermark) need = af->target - level;
+	if(need > sil) data = min_t(uint32_t, avail, need - sil);
+
+	// Rather than let the card play stale audio, pad it out to two frames
+	if(playing && level + sil + data < 2 * frame) {
+		pad = 2 * frame - (level + sil + data);
+		af->underruns++;
+	}
+	if(!sil && !data && !pad) return 0;
+
+	if(sil) end = aja_hostring_sg(card, dma, end, &af->zero, 0, card->caps->aplaybuf, csize, &coff, sil);
+	if(end && data) end = aja_hostring_sg(card, dma, end, &af->ring, af->read % af->size, card->caps->aplaybuf, csize, &coff, data);
+	if(end && pad) end = aja_hostring_sg(card, dma, end, &af->zero, 0, card->caps->aplaybuf, csize, &coff, pad);
+	if(end == NULL) return -ENOMEM;
+
+	ret = aja_hostring_run(card, dma, end, atomic);
+	if(ret) return ret;
+
+	af->cwr = coff;
+	af->read += data;
+	af->silence += sil + pad;
+	return 0;
+}
+
+/* Per frame feeder upkeep, from the IRQ thread */
+static void aja_afeed_frame(aja_card_t *card) {
+	aja_afeed_t 	*af = &card->afeed;
+	aja_dma_t 	*dma = &card->dma[AJA_AUDIO_DMA];
+	int 		atomic = in_interrupt();
+
+	if(!af->running) return;
+	if(aja_hostring_lock(&af->lock, dma, atomic)) return;
+	if(af->running) aja_afeed_fill(card, dma, atomic);
+	aja_hostring_unlock(&af->lock, dma);
+	return;
+}
+
+/* Passes a playback stream speed decision on to the feeder.  'inc' is the number of
+ * frames the video moves on this frame.  Called from the hard IRQ */
+static void aja_afeed_bump(aja_card_t *card, int inc) {
+	if(!card->afeed.running) return;
+	if(inc == 0) atomic_inc(&card->afeed.hold);
+	else if(inc > 1) atomic_add(inc - 1, &card->afeed.skip);
+	return;
+}
+
+static int aja_firmware_ready_wait(aja_card_t *card) {
+	int i;
+	// Waiting for program/ready bit to clear
+	for(i = 0; i < AJA_FIRMWARE_TIMEOUT; i++) {
+		if(!(aja_ioread(card, 0x44) & 0x100)) break;
+		mdelay(1);
+	}
+	if(i == AJA_FIRMWARE_TIMEOUT) return 1;
+	return 0;
+}
+
+static int aja_firmware_done_wait(aja_card_t *card) {
+	int i;
+	// Waiting for done bit to go high
 	for(i = 0; i < AJA_FIRMWARE_TIMEOUT; i++) {
-		if(ioread32(preg) & 0x200) break;	// Break on 
+		if(aja_ioread(card, 0x44) & 0x200) break;	// Break on 
 		mdelay(1);
 	}
 	if(i == AJA_FIRMWARE_TIMEOUT) return 1;
 	return 0;
 }
 
+/* The bitstream bytes are not traced, they would flush every other access out of
+ * the trace rings */
 static int aja_firmware_upload(aja_card_t *card, size_t bytes, uint8_t *data) {
 	void __iomem *preg = card->regadd + 0x44;
 	uint32_t val;
@@ -1120,13 +2189,12 @@ static int aja_firmware_upload(aja_card_t *card, size_t bytes, uint8_t *data) {
 }
 
 static int aja_alive_wait(aja_card_t *card) {
-	void __iomem *preg = card->regadd + 0x70;
 	int 		i, ok = 0;
 	uint32_t 	v1, v2;
 
-	v1 = ioread32(preg);
+	v1 = aja_ioread(card, 0x70);
 	for(i = AJA_FIRMWARE_TIMEOUT; i > 0; i--) {
-		v2 = ioread32(preg);
+		v2 = aja_ioread(card, 0x70);
 		if(v1 == v2) {
 			mdelay(1);
 		} else {
@@ -1139,16 +2207,14 @@ static int aja_alive_wait(aja_card_t *card) {
 }
 
 static int aja_firmware_load(aja_card_t *card, int id, size_t bytes, uint8_t *data) {
-	void __iomem *preg = card->regadd + 0x44;
-
 	pinfo("Card %d: Loading firmware 0x%X, %zd bytes\n", card->index, id, bytes);
 
 	// Start the programing cycle
 	card->fwid = id;
 	aja_irqset(card, 0);
 
-	iowrite32(0x2000000, preg); // PCI-X programming mode
-	iowrite32(0x100, preg);	// Start FPGA program
+	aja_iowrite(card, 0x2000000, 0x44); // PCI-X programming mode
+	aja_iowrite(card, 0x100, 0x44);	// Start FPGA program
 	if(aja_firmware_ready_wait(card)) {
 		perror("Firmware 0x%X ready wait failed\n", id);
 		goto fwloadbail;
@@ -1163,11 +2229,12 @@ static int aja_firmware_load(aja_card_t *card, int id, size_t bytes, uint8_t *da
 		goto fwloadbail;
 	}
 
-	iowrite32(0x400, preg);	// Reset the FPGA
+	aja_iowrite(card, 0x400, 0x44);	// Reset the FPGA
 	if(aja_alive_wait(card)) {
 		perror("Firmware 0x%X wait for alive failed\n", id);
 		goto fwloadbail;
 	}
+	aja_shadow_seed(card);	// The FPGA reset put the registers back to their defaults
 	aja_irqset(card, 1);
 	return 0;
 
@@ -1249,6 +2316,77 @@ static int aja_ioctl_setregister(aja_card_t *card, const unsigned long v) {
 	return aja_prset(card, rio.reginfo, rio.value);
 }
 
+static int aja_registerv_valid(aja_card_t *card, const aja_register_t *reg) {
+	if((card->caps->flags & AJA_SmallReg) && (reg->add > 255)) return 0;
+	if(reg->add > card->reglen || (reg->add & 3) || reg->shift > 31) return 0;
+	return 1;
+}
+
+static int aja_ioctl_registerv(aja_card_t *card, const unsigned long v) {
+	aja_registerv_t 	rv;
+	aja_registerio_t 	*regs;
+	unsigned long 		flags;
+	int 			i, ret = 0;
+
+	if(copy_from_user((void *)&rv, (const void *)v, sizeof(rv))) return -EFAULT;
+	if(rv.count < 1 || rv.count > AJA_MAXREGV) return -EINVAL;
+
+	regs = kmalloc(rv.count * sizeof(aja_registerio_t), GFP_KERNEL);
+	if(regs == NULL) return -ENOMEM;
+	if(copy_from_user((void *)regs, (const void *)rv.regs, rv.count * sizeof(aja_registerio_t))) {
+		ret = -EFAULT;
+		goto regv_out;
+	}
+	for(i = 0; i < rv.count; i++) {
+		if(!aja_registerv_valid(card, &regs[i].reginfo)) {
+			perror("Register vector entry %d: invalid register %u\n", i, regs[i].reginfo.add / 4);
+			ret = -EINVAL;
+			goto regv_out;
+		}
+	}
+
+	if(rv.flags & AJA_RegWrite) {
+		if(rv.flags & AJA_RegNextFrame) {
+			// Queue them up for aja_handle_frame()
+			spin_lock_irqsave(&card->spin_reg, flags);
+			if(card->regq.count + rv.count > AJA_MAXREGV) {
+				ret = -EBUSY;
+			} else {
+				memcpy(&card->regq.regs[card->regq.count], regs, rv.count * sizeof(aja_registerio_t));
+				card->regq.count += rv.count;
+			}
+			spin_unlock_irqrestore(&card->spin_reg, flags);
+			if(ret) goto regv_out;
+		} else {
+			for(i = 0; i < rv.count; i++) aja_prset(card, regs[i].reginfo, regs[i].value);
+		}
+	}
+
+	if(rv.flags & AJA_RegRead) {
+		for(i = 0; i < rv.count; i++) regs[i].value = aja_prget(card, regs[i].reginfo);
+		if(copy_to_user((void *)rv.regs, (const void *)regs, rv.count * sizeof(aja_registerio_t))) ret = -EFAULT;
+	}
+
+regv_out:
+	kfree(regs);
+	return ret;
+}
+
+/* Applies the queued register writes.  Called from the output vertical IRQ */
+static void aja_registerv_apply(aja_card_t *card) {
+	unsigned long 	flags;
+	int 		i;
+
+	spin_lock_irqsave(&card->spin_reg, flags);
+	for(i = 0; i < card->regq.count; i++) {
+		aja_register_t *reg = &card->regq.regs[i].reginfo;
+		aja_prwrite_locked(card, reg->add, reg->mask, card->regq.regs[i].value << reg->shift);
+	}
+	card->regq.count = 0;
+	spin_unlock_irqrestore(&card->spin_reg, flags);
+	return;
+}
+
 static int aja_ioctl_irqcount(aja_card_t *card, const unsigned long v) {
 	aja_irqcountget_t get;
 	copy_from_user((void *)&get, (const void *)v, sizeof(get.type));
@@ -1289,17 +2427,74 @@ static int aja_wait_for_frame(aja_card_t *card) {
 	);
 };
 
+static int aja_ioctl_irqtiming(aja_card_t *card, const unsigned long v) {
+	aja_timing_t 	t;
+	unsigned long 	flags;
+	spin_lock_irqsave(&card->spin_reg, flags);
+	t = card->thread.timing;
+	spin_unlock_irqrestore(&card->spin_reg, flags);
+	if(copy_to_user((void *)v, (const void *)&t, sizeof(t))) return -EFAULT;
+	return 0;
+}
+
 static int aja_ioctl_frame_curid(aja_card_t *card, const unsigned long v) {
 	int64_t val = card->frame.id;
 	copy_to_user((void *)v, (const void *)&val, sizeof(val));
 	return 0;
 }
 
-static int aja_ioctl_frame_curtime(aja_card_t *card, const unsigned long v) {
+/* Publishes the current frame to the frame clock page.  Only called from the
+ * output IRQ, which is the only writer */
+static void aja_frameclock_update(aja_card_t *card, int running) {
+	aja_frameclock_t *clk = card->frame.clock;
+	if(unlikely(clk == NULL)) return;
+	clk->seq++;
+	smp_wmb();
+	clk->fifo = atomic_read(&card->stream.fifo);
+	clk->running = running;
+	clk->tcgflags = atomic_read(&card->tcg.flags);
+	clk->time = card->frame.time;
+	clk->sync = card->clockfit.sync;
+	smp_wmb();
+	clk->seq++;
+	return;
+}
+
+/* Reads the current frame time without taking any locks */
+static void aja_frameclock_get(aja_card_t *card, aja_frametime_t *t) {
+	aja_frameclock_t *clk = card->frame.clock;
 	unsigned long flags;
+	uint32_t seq;
+
+	if(unlikely(clk == NULL)) {
+		spin_lock_irqsave(&card->spin_reg, flags);
+		*t = card->frame.time;
+		spin_unlock_irqrestore(&card->spin_reg, flags);
+		return;
+	}
+	do {
+		seq = clk->seq;
+		smp_rmb();
+		*t = clk->time;
+		smp_rmb();
+	} while((seq & 1) || seq != clk->seq);
+	return;
+}
+
+static int aja_ioctl_clocksync(aja_card_t *card, const unsigned long v) {
+	aja_clocksync_t 	cs;
+	unsigned long 		flags;
 	spin_lock_irqsave(&card->spin_reg, flags);
-	copy_to_user((void *)v, (const void *)&card->frame.time, sizeof(card->frame.time));
+	cs = card->clockfit.sync;
 	spin_unlock_irqrestore(&card->spin_reg, flags);
+	if(copy_to_user((void *)v, (const void *)&cs, sizeof(cs))) return -EFAULT;
+	return 0;
+}
+
+static int aja_ioctl_frame_curtime(aja_card_t *card, const unsigned long v) {
+	aja_frametime_t t;
+	aja_frameclock_get(card, &t);
+	if(copy_to_user((void *)v, (const void *)&t, sizeof(t))) return -EFAULT;
 	return 0;
 }
 
@@ -1309,6 +2504,64 @@ static int aja_ioctl_frame_waitfornext(aja_card_t *card, const unsigned long v)
 	return ret ? 0 : -ETIMEDOUT;
 }
 
+/* A frame.until waiter.  The wake function leaves it asleep until its frame has
+ * started, so a wait many frames ahead costs one wake up */
+typedef struct {
+	wait_queue_t 		wait;
+	aja_card_t 		*card;
+	int64_t 		id;
+} aja_frame_waiter_t;
+
+static int aja_frame_wake(wait_queue_t *wait, unsigned mode, int sync, void *key) {
+	aja_frame_waiter_t *w = container_of(wait, aja_frame_waiter_t, wait);
+	if(w->card->frame.id < w->id) return 0;
+	return autoremove_wake_function(wait, mode, sync, key);
+}
+
+/* Jiffies from now until a frame clock (rawclock_ns) time, 0 if it has passed.
+ * The time of day clock can be stepped, this one can't */
+static long aja_deadline_jiffies(int64_t deadline) {
+	struct timespec left;
+	int64_t ns = deadline - rawclock_ns();
+	if(ns <= 0) return 0;
+	left = ns_to_timespec(ns);
+	return timespec_to_jiffies(&left);
+}
+
+static int aja_ioctl_frame_waituntil(aja_card_t *card, const unsigned long v) {
+	aja_frame_waituntil_t 	wu;
+	aja_frame_waiter_t 	w;
+	long 			timeout = MAX_SCHEDULE_TIMEOUT;
+	int 			ret = 0;
+
+	if(copy_from_user(&wu, (const void *)v, sizeof(wu))) return -EFAULT;
+	if(wu.deadline) timeout = aja_deadline_jiffies(wu.deadline);
+
+	init_waitqueue_func_entry(&w.wait, aja_frame_wake);
+	w.wait.private = current;
+	w.card = card;
+	w.id = wu.id;
+
+	for(;;) {
+		prepare_to_wait(&card->frame.until, &w.wait, TASK_INTERRUPTIBLE);
+		if(card->frame.id >= wu.id) break;
+		if(signal_pending(current)) {
+			ret = -ERESTARTSYS;
+			break;
+		}
+		if(!timeout) {
+			ret = -ETIMEDOUT;
+			break;
+		}
+		timeout = schedule_timeout(timeout);
+	}
+	finish_wait(&card->frame.until, &w.wait);
+
+	aja_frameclock_get(card, &wu.time);
+	if(copy_to_user((void *)v, (const void *)&wu, sizeof(wu))) return -EFAULT;
+	return ret;
+}
+
 static int aja_ioctl_dma(aja_card_t *card, const unsigned long v) {
 	aja_dmainfo_t dmainfo;
 	copy_from_user((void *)&dmainfo, (const void *)v, sizeof(aja_dmainfo_t));
@@ -1333,9 +2586,13 @@ static void aja_stream_clear(aja_card_t *card) {
 	atomic_set(&card->stream.running, 0);
 	atomic_set(&card->stream.fifo, 0);
 	card->stream.trigger = 0;
+	card->stream.ring = 0;
 	atomic_set(&card->stream.speed, 1 * AJA_SPEED_DIVISOR);
 	card->stream.pfirst = NULL;
 	card->stream.plast = NULL;
+	card->stream.playlist.active = 0;
+	card->thread.donect = 0;
+	card->thread.gen++;
 	memset(card->stream.last, 0, sizeof(card->stream.last));
 	for(i = 0; i < AJA_MAXPAGES; i++) {
 		aja_pageitem_t *p = &card->stream.pagealloc[i];
@@ -1409,12 +2666,11 @@ static int aja_stream_fifo_push(aja_card_t *card, int page) {
 	return 0;
 }
 
-static int aja_stream_fifo_pop(aja_card_t *card) {
-	unsigned long 		flags;
+/* Pops the head of the fifo, spin_reg must be held */
+static int aja_stream_fifo_pop_locked(aja_card_t *card) {
 	aja_pageitem_t 		*p, *np;
 	int 			ret = -EAGAIN;
 
-	spin_lock_irqsave(&card->spin_reg, flags);
 	p = (aja_pageitem_t *)card->stream.pfirst;
 	if(p != NULL) {
 		ret = p->page;
@@ -1427,6 +2683,15 @@ static int aja_stream_fifo_pop(aja_card_t *card) {
 		card->stream.pfirst = np;
 	}
 	atomic_dec(&card->stream.fifo);
+	return ret;
+}
+
+static int aja_stream_fifo_pop(aja_card_t *card) {
+	unsigned long 		flags;
+	int 			ret;
+
+	spin_lock_irqsave(&card->spin_reg, flags);
+	ret = aja_stream_fifo_pop_locked(card);
 	spin_unlock_irqrestore(&card->spin_reg, flags);
 	//pinfo("POP: %d\n", ret);
 	//pinfo("pop %d, fifo %d\n", ret, atomic_read(&card->stream.fifo));
@@ -1434,13 +2699,48 @@ static int aja_stream_fifo_pop(aja_card_t *card) {
 	//while(p != NULL) {
 	//	pinfo("ITEM %d\n", p->page);
 	//	p = p->next;
-	//}	
+	//}
+	return ret;
+}
+
+/* Drops whole frames from the head of the fifo until no more than 'keep' remain.
+ * Used by the capture ring to recycle the oldest frames.  spin_reg is held
+ * throughout, so a push or pop can't split a frame.  While the ring is running
+ * each recycled frame is counted in the drop stats and flagged AJA_FrameDropped,
+ * the preroll trim of AJACTL_STREAM_RECORD is not.  Returns frames dropped */
+static int aja_stream_fifo_trim(aja_card_t *card, int keep) {
+	int 		chans = card->stream.chans;
+	int 		n, page, ret = 0;
+	int 		ring = card->stream.ring;
+	unsigned long 	flags;
+
+	spin_lock_irqsave(&card->spin_reg, flags);
+	while(atomic_read(&card->stream.fifo) >= chans &&
+	      atomic_read(&card->stream.fifo) > keep * chans) {
+		for(n = 0; n < chans; n++) {
+			page = aja_stream_fifo_pop_locked(card);
+			if(page < 0) goto trimbail;
+			atomic_set(&card->stream.pagealloc[page].inuse, 0);
+			if(!ring) continue;
+			card->stream.meta[page].flags |= AJA_FrameDropped;
+			if(n) continue;
+			card->stream.drop.count++;
+			card->stream.drop.id = card->stream.meta[page].timing.id;
+			card->stream.drop.tc = card->stream.meta[page].tc[AJA_TimecodeInternal];
+		}
+		ret++;
+	}
+trimbail:
+	spin_unlock_irqrestore(&card->spin_reg, flags);
 	return ret;
 }
 
 static void aja_stream_start(aja_card_t *card) {
 	card->stream.trigger = 0;
 	card->stream.atrig = card->stream.flags & AJA_TriggerAudio;
+	card->acapring.due = 0;
+	card->acapring.valid = 0;
+	aja_avmon_setup(card);
 	atomic_set(&card->stream.running, 1);
 	if(card->pcitc) pcitc.run(card->pcitc, 1);
 	aja_timecode_setflags(card, AJA_TCG_Running);
@@ -1448,19 +2748,22 @@ static void aja_stream_start(aja_card_t *card) {
 }
 
 static void aja_stream_stop(aja_card_t *card) {
+	aja_regtx_t tx;
 	card->stream.trigger = 0;
 	card->stream.atrig = 0;
 	atomic_set(&card->stream.running, 0);
 	if(card->pcitc) pcitc.run(card->pcitc, 0);
 	aja_timecode_clrflags(card, AJA_TCG_Running);
 
+	aja_regtx_begin(&tx);
 	if(card->stream.flags & AJA_TriggerAudio) {
-		if(card->stream.flags & AJA_Playback) aja_aplay_stop(card);
-		if(card->stream.flags & AJA_Capture) aja_acap_stop(card);
+		if(card->stream.flags & AJA_Playback) aja_regtx_set(&tx, ajareg_aplayreset, 1);	/* aja_aplay_stop() */
+		if(card->stream.flags & AJA_Capture) aja_regtx_set(&tx, ajareg_acapenable, 0);	/* aja_acap_stop() */
 	}
-	aja_prset(card, ajareg_ch1mode, 0); /* Put ch1 back into playback mode */
-	aja_prset(card, ajareg_ch2mode, 0); 
-	aja_prset(card, ajareg_regclocking, 0); // Go back to field clocking.
+	aja_regtx_set(&tx, ajareg_ch1mode, 0); /* Put ch1 back into playback mode */
+	aja_regtx_set(&tx, ajareg_ch2mode, 0);
+	aja_regtx_set(&tx, ajareg_regclocking, 0); // Go back to field clocking.
+	aja_regtx_commit(card, &tx);
 	return;
 }
 
@@ -1468,6 +2771,7 @@ static void aja_stream_stop(aja_card_t *card) {
 static int aja_ioctl_stream_init(aja_card_t *card, const unsigned long v) {
 	int 			pagect;
 	aja_stream_init_t 	stinit;
+	aja_regtx_t 		tx;
 	copy_from_user((void *)&stinit, (const void *)v, sizeof(stinit));
 
 	if(stinit.chans < 1) stinit.chans = 1;
@@ -1476,26 +2780,45 @@ static int aja_ioctl_stream_init(aja_card_t *card, const unsigned long v) {
 	pagect = stinit.pagect;
 	if(pagect > AJA_MAXPAGES) pagect = AJA_MAXPAGES;
 
+	if(!(stinit.flags & AJA_Capture)) stinit.flags &= ~AJA_CaptureAudio;
+#ifdef AJA_ALSA
+	// The stream's audio trigger would reset the card capture under the ALSA PCM
+	if((stinit.flags & AJA_Capture) && (stinit.flags & AJA_TriggerAudio) &&
+	   card->alsa.stream[SNDRV_PCM_STREAM_CAPTURE].substream) return -EBUSY;
+#endif
+#ifdef AJA_AUDIO_RINGS
+	aja_stream_clear(card);
+	if(stinit.flags & AJA_CaptureAudio) {
+		int ret = aja_acapring_setup(card, pagect);
+		if(ret) return ret;
+	}
+#else
+	// Refused before the running stream is cleared
+	if(stinit.flags & AJA_CaptureAudio) return -EOPNOTSUPP;
 	aja_stream_clear(card);
+#endif
 	card->stream.flags = stinit.flags;
 	card->stream.pagect = pagect;
 	card->stream.chans = stinit.chans;
 	card->stream.tcsource = stinit.tcsource;
+	card->stream.ring = (stinit.flags & AJA_Capture) && (stinit.flags & AJA_CaptureRing);
 
 	// Make sure any register changes happen right away.
-	aja_prset(card, ajareg_regclocking, 2);
+	aja_regtx_begin(&tx);
+	aja_regtx_set(&tx, ajareg_regclocking, 2);
 
 	/* Set the dma pointer (next) to the first frame to dma */
 	if(stinit.flags & AJA_Playback) {
-		aja_prset(card, ajareg_ch1mode, 0); /* Playback mode */
-		aja_prset(card, ajareg_ch2mode, 0);
+		aja_regtx_set(&tx, ajareg_ch1mode, 0); /* Playback mode */
+		aja_regtx_set(&tx, ajareg_ch2mode, 0);
 	} else {
-		aja_prset(card, ajareg_ch1mode, 1);
-		aja_prset(card, ajareg_ch2mode, 1);
+		aja_regtx_set(&tx, ajareg_ch1mode, 1);
+		aja_regtx_set(&tx, ajareg_ch2mode, 1);
 	}
 	
 	/* If we are doing dual buffering, set the ch2 input/output to the frame after the ch1 input/output */
-	aja_prset(card, ajareg_ch2disable, stinit.chans > 1 ? 0 : 1);
+	aja_regtx_set(&tx, ajareg_ch2disable, stinit.chans > 1 ? 0 : 1);
+	aja_regtx_commit(card, &tx);
 	return 0;
 }	
 
@@ -1619,6 +2942,219 @@ static int aja_ioctl_stream_settrig(aja_card_t *card, const unsigned long v) {
 	return 0;
 }
 
+static int aja_ioctl_stream_playlist(aja_card_t *card, const unsigned long v) {
+	int 			i, pagect;
+	unsigned long 		flags;
+	aja_stream_playlist_t 	list;
+	aja_pageitem_t 		*p;
+	aja_playlist_t 		*pl = &card->stream.playlist;
+	int 			chans = card->stream.chans > 0 ? card->stream.chans : 1;
+
+	if(copy_from_user((void *)&list, (const void *)v, sizeof(list))) return -EFAULT;
+
+	/* A zero count clears the playlist and returns playback to the fifo */
+	if(list.count <= 0) {
+		pl->active = 0;
+		return 0;
+	}
+
+	pagect = list.count * chans;
+	if(pagect > AJA_MAXPAGES) return -EINVAL;
+	if(list.in < 0 || list.out >= list.count || list.in > list.out) return -EINVAL;
+	if(list.loops < 0) return -EINVAL;
+	for(i = 0; i < pagect; i++) {
+		if(!IsValidPage(list.pages[i])) {
+			perror("Playlist entry %d: invalid page %d\n", i, list.pages[i]);
+			return -EINVAL;
+		}
+	}
+
+	/* The playlist pages are played over and over, so none may still be waiting
+	 * on the fifo, where playback would hand them back to be refilled */
+	spin_lock_irqsave(&card->spin_reg, flags);
+	for(p = card->stream.pfirst; p != NULL; p = p->next) {
+		for(i = 0; i < pagect; i++) {
+			if(list.pages[i] == p->page) {
+				spin_unlock_irqrestore(&card->spin_reg, flags);
+				perror("Playlist entry %d: page %d is queued on the fifo\n", i, p->page);
+				return -EBUSY;
+			}
+		}
+	}
+	pl->count = list.count;
+	pl->in = list.in;
+	pl->out = list.out;
+	pl->loops = list.loops;
+	pl->pos = list.in;
+	pl->pass = 0;
+	memcpy(pl->pages, list.pages, pagect * sizeof(int));
+	pl->active = 1;
+	spin_unlock_irqrestore(&card->spin_reg, flags);
+	return 0;
+}
+
+static int aja_ioctl_stream_record(aja_card_t *card, const unsigned long v) {
+	int preroll;
+	if(copy_from_user((void *)&preroll, (const void *)v, sizeof(preroll))) return -EFAULT;
+	if(preroll < 0) return -EINVAL;
+	if(!(card->stream.flags & AJA_Capture)) return -EINVAL;
+
+	// Stop overwriting first so the capture can't recycle what we keep
+	card->stream.ring = 0;
+	aja_stream_fifo_trim(card, preroll);
+	return atomic_read(&card->stream.fifo) / card->stream.chans;
+}
+
+static int aja_ioctl_stream_audioring(aja_card_t *card, const unsigned long v) {
+	aja_acapring_t 	*ar = &card->acapring;
+	aja_audioring_t ring;
+	memset(&ring, 0, sizeof(ring));
+	down(&ar->lock);
+	ring.size = ar->ring.npages << PAGE_SHIFT;
+	ring.slotsize = ar->slotsize;
+	ring.channels = ar->channels;
+	ring.samplebytes = ar->fbytes;
+	ring.rate = AJA_AUDIO_RATE;
+	up(&ar->lock);
+	if(copy_to_user((void *)v, (const void *)&ring, sizeof(ring))) return -EFAULT;
+	return 0;
+}
+
+#ifdef AJA_AUDIO_RINGS
+static int aja_ioctl_afeed_init(aja_card_t *card, const unsigned long v) {
+	aja_afeed_t 		*af = &card->afeed;
+	aja_afeed_init_t 	init;
+	uint32_t 		rate = aja_prget(card, ajareg_framerate) & 7;
+	uint32_t 		frame;
+	int 			ret = 0;
+
+	if(copy_from_user((void *)&init, (const void *)v, sizeof(init))) return -EFAULT;
+	if(init.size > AJA_AFEED_MAXSIZE) return -EINVAL;
+
+	down(&af->lock);
+	if(af->running) {
+		up(&af->lock);
+		return -EBUSY;
+	}
+
+	af->fbytes = aja_audio_channels(card) * AJA_AUDIO_SAMPLEBYTES;
+	af->num = aja_acap_cadence[rate][0];
+	af->den = aja_acap_cadence[rate][1];
+	if(!af->den) {
+		af->num = AJA_AUDIO_RATE;
+		af->den = 30;
+	}
+	frame = (af->num + af->den - 1) / af->den * af->fbytes;
+
+	// The card buffer must keep well clear of the play point
+	if(!init.watermark) init.watermark = 4 * frame;
+	if(!init.target) init.target = 2 * init.watermark;
+	if(init.target > AJA_APLAY_CARDSIZE / 2) init.target = AJA_APLAY_CARDSIZE / 2;
+	if(init.watermark >= init.target) init.watermark = init.target / 2;
+	init.size = PAGE_ALIGN(init.size ? init.size : 4 * init.target);
+	af->watermark = init.watermark;
+	af->target = init.target;
+
+	if(af->ring.pages && af->size != init.size) aja_hostring_free(card, &af->ring);
+	af->size = init.size;
+	if(af->ring.pages == NULL) ret = aja_hostring_alloc(card, &af->ring, init.size >> PAGE_SHIFT, PCI_DMA_TODEVICE);
+	if(!ret && af->zero.pages == NULL) ret = aja_hostring_alloc(card, &af->zero, 1, PCI_DMA_TODEVICE);
+	if(!ret) aja_audio_dma_claim(card);
+	af->written = 0;
+	af->read = 0;
+	af->silence = 0;
+	af->skipped = 0;
+	af->underruns = 0;
+	up(&af->lock);
+
+	if(ret) return ret;
+	if(copy_to_user((void *)v, (const void *)&init, sizeof(init))) return -EFAULT;
+	return 0;
+}
+#else
+static int aja_ioctl_afeed_init(aja_card_t *card, const unsigned long v) {
+	return -EOPNOTSUPP;
+}
+#endif
+
+static int aja_ioctl_afeed_start(aja_card_t *card) {
+	aja_afeed_t 	*af = &card->afeed;
+	aja_dma_t 	*dma = &card->dma[AJA_AUDIO_DMA];
+	int 		ret;
+
+	if(aja_hostring_lock(&af->lock, dma, 0)) return -EBUSY;
+	if(af->ring.pages == NULL || af->zero.pages == NULL) {
+		ret = -EINVAL;
+#ifdef AJA_ALSA
+	} else if(card->alsa.stream[SNDRV_PCM_STREAM_PLAYBACK].substream) {
+		ret = -EBUSY;	// The ALSA PCM has the card playback
+#endif
+	} else {
+		// Hold the card in reset and prime it from the start of its buffer
+		aja_aplay_stop(card);
+		af->cwr = 0;
+		af->acc = 0;
+		atomic_set(&af->hold, 0);
+		atomic_set(&af->skip, 0);
+		ret = aja_afeed_fill(card, dma, 0);
+		if(!ret) af->running = 1;
+	}
+	aja_hostring_unlock(&af->lock, dma);
+	return ret;
+}
+
+static int aja_ioctl_afeed_stop(aja_card_t *card) {
+	down(&card->afeed.lock);
+	card->afeed.running = 0;
+	aja_aplay_stop(card);
+	up(&card->afeed.lock);
+	return 0;
+}
+
+static int aja_ioctl_afeed_commit(aja_card_t *card, const unsigned long v) {
+	aja_afeed_t 	*af = &card->afeed;
+	uint32_t 	bytes;
+	int 		ret = 0;
+
+	if(copy_from_user((void *)&bytes, (const void *)v, sizeof(bytes))) return -EFAULT;
+	down(&af->lock);
+	if(af->written + bytes - af->read > af->size) ret = -ENOSPC;
+	else af->written += bytes;
+	up(&af->lock);
+	return ret;
+}
+
+static int aja_ioctl_afeed_status(aja_card_t *card, const unsigned long v) {
+	aja_afeed_t 		*af = &card->afeed;
+	aja_afeed_status_t 	st;
+	uint32_t 		rd = 0;
+
+	down(&af->lock);
+	if(!aja_prget(card, ajareg_aplayreset)) rd = aja_prget(card, ajareg_aplaylast) % AJA_APLAY_CARDSIZE;
+	st.written = af->written;
+	st.read = af->read;
+	st.silence = af->silence;
+	st.skipped = af->skipped;
+	st.size = af->size;
+	st.level = af->running ? (af->cwr + AJA_APLAY_CARDSIZE - rd) % AJA_APLAY_CARDSIZE : 0;
+	st.underruns = af->underruns;
+	st.samplebytes = af->fbytes;
+	st.running = af->running;
+	up(&af->lock);
+	if(copy_to_user((void *)v, (const void *)&st, sizeof(st))) return -EFAULT;
+	return 0;
+}
+
+static int aja_ioctl_stream_playlist_pos(aja_card_t *card, const unsigned long v) {
+	int 		ret;
+	unsigned long 	flags;
+	aja_playlist_t 	*pl = &card->stream.playlist;
+	spin_lock_irqsave(&card->spin_reg, flags);
+	ret = pl->active ? pl->pos : -1;
+	spin_unlock_irqrestore(&card->spin_reg, flags);
+	return ret;
+}
+
 static int aja_ioctl_aplay_position(aja_card_t *card, const unsigned long v) {
 	aja_audio_position_t pos = aja_aplay_position(card);
 	copy_to_user((void *)v, (const void *)&pos, sizeof(aja_audio_position_t));
@@ -1631,6 +3167,48 @@ static int aja_ioctl_acap_position(aja_card_t *card, const unsigned long v) {
 	return 0;
 }
 
+static int aja_ioctl_avdrift(aja_card_t *card, const unsigned long v) {
+	aja_avmon_t 	m;
+	aja_avdrift_t 	st;
+	unsigned long 	flags;
+
+	spin_lock_irqsave(&card->spin_reg, flags);
+	m = card->avmon;
+	spin_unlock_irqrestore(&card->spin_reg, flags);
+
+	memset(&st, 0, sizeof(st));
+	if(m.cap.valid) {
+		st.frames = m.cap.frames;
+		st.capture = AJA_AVDRIFT_US((int32_t)(m.cap.samples - m.cap.expect));
+		if(m.cap.expect) st.capture_rate = (int32_t)div64_s64((m.cap.samples - m.cap.expect) * 1000000000LL, m.cap.expect);
+	}
+	if(m.play.valid) {
+		st.play_frames = m.play.frames;
+		st.playback = AJA_AVDRIFT_US((int32_t)(m.play.samples - m.play.expect));
+		if(m.play.expect) st.playback_rate = (int32_t)div64_s64((m.play.samples - m.play.expect) * 1000000000LL, m.play.expect);
+	}
+	st.skew = m.skew;
+	st.worst = AJA_AVDRIFT_US(m.worst);
+	st.limit = avdrift > 0 ? avdrift : 0;
+	st.events = m.events;
+	st.resets = m.resets;
+	st.event_id = m.event_id;
+	if(copy_to_user((void *)v, (const void *)&st, sizeof(st))) return -EFAULT;
+	return 0;
+}
+
+static int aja_ioctl_uart_stats(aja_card_t *card, const unsigned long v) {
+	aja_uartstats_t st;
+	unsigned long 	flags;
+	spin_lock_irqsave(&card->slavepkt.lock, flags);
+	st = card->slavepkt.stats;
+	spin_unlock_irqrestore(&card->slavepkt.lock, flags);
+	st.fifo = uart_fifo > 0 ? uart_fifo : 1;
+	st.timeout = uart_timeout;
+	if(copy_to_user((void *)v, (const void *)&st, sizeof(st))) return -EFAULT;
+	return 0;
+}
+
 static int aja_ioctl_dmabench(aja_card_t *card, const unsigned long v) {
 	int engine;
 	copy_from_user((void *)&engine, (const void *)v, sizeof(int));
@@ -1642,7 +3220,7 @@ static int aja_ioctl_dmabench(aja_card_t *card, const unsigned long v) {
 
 static int aja_ioctl_lutload(aja_card_t *card, const unsigned long v) {
 	int i;
-	void *c1a, *c2a, *c3a;
+	uint32_t c1a, c2a, c3a;
 	uint32_t *c1, *c2, *c3;
 	aja_lut_t *lut;
 
@@ -1654,17 +3232,17 @@ static int aja_ioctl_lutload(aja_card_t *card, const unsigned long v) {
 	}
 
 	copy_from_user((void *)lut, (const void *)v, sizeof(*lut));
-	c1a = card->regadd + 0x800;
-	c2a = card->regadd + 0x1000;
-	c3a = card->regadd + 0x1800;
+	c1a = 0x800;
+	c2a = 0x1000;
+	c3a = 0x1800;
 	c1 = lut->c1;
 	c2 = lut->c2;
 	c3 = lut->c3;
 
 	for(i = 0; i < 512; i++) {
-		iowrite32(*c1++, c1a);
-		iowrite32(*c2++, c2a);
-		iowrite32(*c3++, c3a);
+		aja_iowrite(card, *c1++, c1a);
+		aja_iowrite(card, *c2++, c2a);
+		aja_iowrite(card, *c3++, c3a);
 		c1a += 4; c2a += 4; c3a += 4;
 	}
 	vfree(lut);
@@ -1704,10 +3282,17 @@ int aja_ioctl(struct inode *inode, struct file *filp, unsigned int call, unsigne
 		case AJACTL_GETAPIVER: 			ret = aja_ioctl_getapiver(card, val); break;
 		case AJACTL_GETREGISTER: 		ret = aja_ioctl_getregister(card, val); break;
 		case AJACTL_SETREGISTER: 		ret = aja_ioctl_setregister(card, val); break;
+		case AJACTL_REGISTERV: 			ret = aja_ioctl_registerv(card, val); break;
 		case AJACTL_IRQCOUNT: 			ret = aja_ioctl_irqcount(card, val); break;
 		case AJACTL_IRQSLEEP: 			ret = aja_ioctl_irqsleep(card, val); break;
+		case AJACTL_IRQTIMING: 			ret = aja_ioctl_irqtiming(card, val); break;
 		case AJACTL_IRQENABLE:			ret = aja_ioctl_irqenable(card, val); break;
 		case AJACTL_DMA: 			ret = aja_ioctl_dma(card, val); break;
+		case AJACTL_AFEED_INIT: 		ret = aja_ioctl_afeed_init(card, val); break;
+		case AJACTL_AFEED_START: 		ret = aja_ioctl_afeed_start(card); break;
+		case AJACTL_AFEED_STOP: 		ret = aja_ioctl_afeed_stop(card); break;
+		case AJACTL_AFEED_COMMIT: 		ret = aja_ioctl_afeed_commit(card, val); break;
+		case AJACTL_AFEED_STATUS: 		ret = aja_ioctl_afeed_status(card, val); break;
 		case AJACTL_APLAY_START: 		ret = aja_aplay_start(card); break;
 		case AJACTL_APLAY_STOP: 		ret = aja_aplay_stop(card); break;
 		case AJACTL_APLAY_POSITION: 		ret = aja_ioctl_aplay_position(card, val); break;
@@ -1716,6 +3301,8 @@ int aja_ioctl(struct inode *inode, struct file *filp, unsigned int call, unsigne
 		case AJACTL_ACAP_START: 		ret = aja_acap_start(card); break;
 		case AJACTL_ACAP_STOP: 			ret = aja_acap_stop(card); break;
 		case AJACTL_ACAP_POSITION: 		ret = aja_ioctl_acap_position(card, val); break;
+		case AJACTL_AVDRIFT: 			ret = aja_ioctl_avdrift(card, val); break;
+		case AJACTL_UART_STATS: 		ret = aja_ioctl_uart_stats(card, val); break;
 		case AJACTL_DMABENCH: 			ret = aja_ioctl_dmabench(card, val); break;
 		case AJACTL_LUTLOAD:			ret = aja_ioctl_lutload(card, val); break;
 		case AJACTL_FIRMWARE_LOAD:		ret = aja_ioctl_firmware_load(card, val); break;
@@ -1724,6 +3311,8 @@ int aja_ioctl(struct inode *inode, struct file *filp, unsigned int call, unsigne
 		case AJACTL_FRAME_CURID: 		ret = aja_ioctl_frame_curid(card, val); break;
 		case AJACTL_FRAME_CURTIME: 		ret = aja_ioctl_frame_curtime(card, val); break;
 		case AJACTL_FRAME_WAITFORNEXT: 		ret = aja_ioctl_frame_waitfornext(card, val); break;
+		case AJACTL_FRAME_WAITUNTIL: 		ret = aja_ioctl_frame_waituntil(card, val); break;
+		case AJACTL_CLOCKSYNC: 			ret = aja_ioctl_clocksync(card, val); break;
 
 		case AJACTL_STREAM_RUNNING: 		ret = aja_ioctl_stream_running(card, val); break;
 		case AJACTL_STREAM_DROPPED: 		ret = aja_ioctl_stream_dropped(card, val); break;
@@ -1740,6 +3329,10 @@ int aja_ioctl(struct inode *inode, struct file *filp, unsigned int call, unsigne
 		case AJACTL_STREAM_SETSPEED: 		ret = aja_ioctl_stream_setspeed(card, val); break;
 		case AJACTL_STREAM_GETSPEED: 		ret = aja_ioctl_stream_getspeed(card, val); break;
 		case AJACTL_STREAM_SETTRIG:		ret = aja_ioctl_stream_settrig(card, val); break;
+		case AJACTL_STREAM_PLAYLIST:		ret = aja_ioctl_stream_playlist(card, val); break;
+		case AJACTL_STREAM_PLAYLIST_POS:	ret = aja_ioctl_stream_playlist_pos(card, val); break;
+		case AJACTL_STREAM_RECORD:		ret = aja_ioctl_stream_record(card, val); break;
+		case AJACTL_STREAM_AUDIORING:		ret = aja_ioctl_stream_audioring(card, val); break;
 
 		case AJACTL_TIMECODE_GETFLAGS: 		ret = aja_ioctl_timecode_getflags(card, val); break;
 		case AJACTL_TIMECODE_SETFLAGS: 		ret = aja_ioctl_timecode_setflags(card, val); break;
@@ -1760,43 +3353,61 @@ int aja_ioctl(struct inode *inode, struct file *filp, unsigned int call, unsigne
 }
 
 static void aja_uart_enable(aja_card_t *card, int val) {
-	aja_prset(card, ajareg_uartenabletx, val);
-	aja_prset(card, ajareg_uartenablerx, val);
+	aja_regtx_t tx;
+	aja_regtx_begin(&tx);
+	aja_regtx_set(&tx, ajareg_uartenabletx, val);
+	aja_regtx_set(&tx, ajareg_uartenablerx, val);
+	aja_regtx_commit(card, &tx);
 	return;
 }
 
+/* RX status: 0x01 has data, 0x04 parity error, 0x08 overrun.  TX status is a list,
+ * see registers.info.  There is no FIFO level and the FIFO depth isn't documented,
+ * so RX goes a byte per status read.  An empty TX FIFO takes uart_fifo bytes in one
+ * burst when the module is told the depth */
 static int aja_uart_rx(aja_card_t *card, uint8_t *data, int max) {
+	aja_uartstats_t *st = &card->slavepkt.stats;
 	uint32_t 	val;
-	int 		i, error = 0;
+	int 		i = 0;
 	
-	for(i = 0; i < max; i++) {
+	while(i < max) {
 		val = aja_prget(card, ajareg_uartstatusrx);
-		if(!val) break; // Break from the loop if there is no data in the FIFO
+		st->statusreads++;
 		if(val & 0x04) {
 			// Check for Parity Error and clear it
 			aja_prset(card, ajareg_uartrxparityerror, 1);
+			st->parity++;
 			return -1;
 		}
 		if(val & 0x08) {
 			// Check for RX buffer overrun
 			aja_prset(card, ajareg_uartrxoverrun, 1);
+			st->overruns++;
 			return -2;
 		}
+		if(!(val & 0x01)) break; // Break from the loop if there is no data in the FIFO
 		val = aja_prget(card, ajareg_uartin);
 		if(data) *data++ = (uint8_t)val;
+		i++;
 	}
-	return (error) ? error : i;
+	st->rxbytes += i;
+	return i;
 }
 
 static int aja_uart_tx(aja_card_t *card, uint8_t *data, int size) {
-	uint32_t val;
-	int i;
-	for(i = 0; i < size; i++) {
+	aja_uartstats_t *st = &card->slavepkt.stats;
+	uint32_t 	val;
+	int 		i = 0, n;
+
+	while(i < size) {
+		val = aja_prget(card, ajareg_uartstatustx);
+		st->statusreads++;
 		// If the FIFO is full, bail.  We are going to have to wait until we can send more.
-		if(aja_prget(card, ajareg_uartstatustx) & 0x02) break;
-		val = *data++;
-		aja_prset(card, ajareg_uartout, val);
+		if(val & 0x02) break;
+		n = (val == 1 && uart_fifo > 0) ? MIN(uart_fifo, size - i) : 1;	// 1 is empty
+		for(; n > 0; n--, i++) aja_prset(card, ajareg_uartout, *data++);
 	}
+	st->txbytes += i;
 	return i;
 }
 
@@ -1810,6 +3421,24 @@ static int aja_slavepkt_size(uint8_t *data) {
 	return (data[0] & 0x0F) + 3;
 }
 
+/* Records the times of a command that has been answered */
+static void aja_slavepkt_done(aja_card_t *card, int64_t now) {
+	aja_slavepkt_t 	*pkt = &card->slavepkt;
+	aja_uartstats_t *st = &pkt->stats;
+	uint32_t 	latency = (uint32_t)(pkt->tx_first - pkt->rx_last);
+	uint32_t 	rxtime = (uint32_t)(pkt->rx_last - pkt->rx_first);
+
+	st->packets++;
+	st->rx_first = pkt->rx_first;
+	st->rx_last = pkt->rx_last;
+	st->tx_first = pkt->tx_first;
+	st->tx_last = now;
+	st->latency = latency;
+	if(latency > st->latency_max) st->latency_max = latency;
+	if(rxtime > st->rxtime_max) st->rxtime_max = rxtime;
+	return;
+}
+
 static void aja_slavepkt_tx(aja_card_t *card) {
 	aja_slavepkt_t 	*pkt = &card->slavepkt;
 	int cbytes, bytes;
@@ -1818,15 +3447,43 @@ static void aja_slavepkt_tx(aja_card_t *card) {
 	cbytes = pkt->outpt;
 	bytes = aja_uart_tx(card, pkt->out + cbytes, pkt->outsize - cbytes);
 	if(bytes > 0) {
+		int64_t now = rawclock_ns();
+		if(!cbytes) pkt->tx_first = now;
 		pkt->outpt += bytes;
 		if(pkt->outpt >= pkt->outsize) {
 			// The packet has completed, setup to Rx another.
+			aja_slavepkt_done(card, now);
 			aja_slavepkt_reset(pkt);
 		}
 	}
 	return;
 }
 
+/* Inter-byte timeout.  A Sony 9-pin master abandons a command that isn't answered
+ * within a few ms, so a part received command is dropped and the UART flushed
+ * rather than waiting for the housekeeping IRQ */
+static enum hrtimer_restart aja_slavepkt_timeout(struct hrtimer *timer) {
+	aja_slavepkt_t 	*pkt = container_of(timer, aja_slavepkt_t, timer);
+	aja_card_t 	*card = container_of(pkt, aja_card_t, slavepkt);
+	unsigned long 	flags;
+	int 		inpt = 0;
+
+	spin_lock_irqsave(&pkt->lock, flags);
+	// More bytes may have come in while the timer was firing
+	if(pkt->state == AJA_SlaveRx && pkt->inpt &&
+	   ktime_to_ns(ktime_sub(ktime_get(), pkt->rx_byte)) >= (int64_t)uart_timeout * 1000) {
+		inpt = pkt->inpt;
+		pkt->stats.timeouts++;
+		aja_slavepkt_reset(pkt);
+		aja_uart_enable(card, 0);
+		aja_uart_enable(card, 1);
+	}
+	spin_unlock_irqrestore(&pkt->lock, flags);
+
+	if(inpt) perror("UART Rx timeout w/ %d bytes\n", inpt);
+	return HRTIMER_NORESTART;
+}
+
 static void aja_slavepkt_rx(aja_card_t *card) {
 	int 		cbytes, bytes;
 	aja_slavepkt_t 	*pkt = &card->slavepkt;
@@ -1836,23 +3493,33 @@ static void aja_slavepkt_rx(aja_card_t *card) {
 		pinfo("ERROR: UART Rx when in Tx state\n");
 		return;
 	}
-	pkt->tstamp = card->irqcount[AJA_AudioWrap];
 	cbytes = pkt->inpt;
 	bytes = aja_uart_rx(card, pkt->in + cbytes, 32 - cbytes);
 	if(bytes > 0) {
+		int64_t now = rawclock_ns();
 		// If this rx contains the first byte, set the size.
-		if(!cbytes) pkt->insize = aja_slavepkt_size(pkt->in);
+		if(!cbytes) {
+			pkt->insize = aja_slavepkt_size(pkt->in);
+			pkt->rx_first = now;
+		}
 		pkt->inpt += bytes;
-		//pinfo("%lld: uart rx %d (%d)\n", pkt->tstamp, bytes, pkt->inpt);
+		//pinfo("%lld: uart rx %d (%d)\n", now, bytes, pkt->inpt);
 		if(pkt->inpt >= pkt->insize) {
 			// Ok, we have a full packet.  Parse it and transmit the response.
+			pkt->rx_last = now;
+			hrtimer_try_to_cancel(&pkt->timer);
 			p2slave_handle_pkt(card->p2slave, pkt->out, pkt->in);
 			pkt->outsize = aja_slavepkt_size(pkt->out);
 			pkt->state = AJA_SlaveTx;
 			aja_slavepkt_tx(card);
+		} else if(uart_timeout > 0) {
+			// Give up on the command if the next byte doesn't come in time
+			pkt->rx_byte = ktime_get();
+			hrtimer_start(&pkt->timer, ns_to_ktime((int64_t)uart_timeout * 1000), HRTIMER_MODE_REL);
 		}
 	} else {
 		perror("UART Rx Error: %d (buf len %d)\n", bytes, cbytes);
+		hrtimer_try_to_cancel(&pkt->timer);
 		aja_slavepkt_reset(pkt);
 		// Ask for the UART to be reset.
 		aja_uart_enable(card, 0);
@@ -1869,16 +3536,24 @@ static int aja_stream_speedcount(aja_card_t *card) {
 	return frms;
 }
 
-/* Frees up frames there were previously played or captured */
+/* Frees up frames there were previously played or captured.  Captured frames
+ * are handed to the IRQ thread, which adds the timecode and pushes them on the fifo */
 static void aja_stream_freeup(aja_card_t *card) {
-	int 		i;
-	timecode_t 	ltc, sdi1, sdi2;
-	uint32_t aptr = aja_prget(card, ajareg_acaplast);
+	int 		i, areset = 0, play, avevent;
+	unsigned long 	flags;
+	uint32_t aptr = ajareg_get_acaplast(card);
+	uint32_t alen = 0, aoff = 0, pptr = 0;
+	int32_t drift;
 
-	// Read the current timecodes
-	aja_timecode_get_ltc(card, &ltc);
-	aja_timecode_get_sdi1(card, &sdi1);
-	aja_timecode_get_sdi2(card, &sdi2);
+	if(card->acapring.due) {
+		card->acapring.due = 0;
+		alen = aja_acap_slice(card, aptr, &aoff, &areset);
+	}
+
+	// The playback pointer is the only extra read, and only while audio plays
+	play = aja_avmon_playing(card);
+	if(play) pptr = ajareg_get_aplaylast(card);
+	drift = aja_avmon_update(card, aptr, play, pptr, &avevent);
 
 	for(i = 0; i < 2; i++) {
 		if(card->stream.last[i].type & AJA_Playback) {
@@ -1887,26 +3562,82 @@ static void aja_stream_freeup(aja_card_t *card) {
 		if(card->stream.last[i].type & AJA_Capture) {
 			int pg = card->stream.last[i].page;
 			card->stream.meta[pg].audioptr = aptr;
-			card->stream.meta[pg].tc[AJA_TimecodeSDI1] = sdi1;
-			card->stream.meta[pg].tc[AJA_TimecodeSDI2] = sdi2;
-			card->stream.meta[pg].tc[AJA_TimecodeLTC] = ltc;
-			aja_stream_fifo_push(card, pg);
+			card->stream.meta[pg].avdrift = drift;
+			if(avevent) card->stream.meta[pg].flags |= AJA_AVDrift;
+			if(i == 0 && alen) {
+				// The frame's audio goes with the first channel
+				card->acapring.cardoff[pg] = aoff;
+				card->stream.meta[pg].audiooffset = pg * card->acapring.slotsize;
+				card->stream.meta[pg].audiolen = alen;
+				if(areset) card->stream.meta[pg].flags |= AJA_ResetAudio;
+			}
+			spin_lock_irqsave(&card->spin_reg, flags);
+			card->thread.done[card->thread.donect++] = pg;
+			spin_unlock_irqrestore(&card->spin_reg, flags);
 		}
 		card->stream.last[i].type = 0;
 	}
 	return;
 }
 
+/* Adds the timecode to the captured frames, transfers their audio and queues
+ * them on the fifo.  Runs in the IRQ thread as the LTC read and DMA may be slow */
+static void aja_stream_capture_done(aja_card_t *card) {
+	int 		i, count;
+	unsigned int 	gen;
+	int 		done[AJA_MAXPAGES];
+	timecode_t 	ltc, sdi1, sdi2;
+	unsigned long 	flags;
+
+	// The pages stay in done until they are on the fifo, so the capture side
+	// never sees them as free in between
+	spin_lock_irqsave(&card->spin_reg, flags);
+	count = card->thread.donect;
+	gen = card->thread.gen;
+	memcpy(done, card->thread.done, count * sizeof(int));
+	spin_unlock_irqrestore(&card->spin_reg, flags);
+	if(!count) return;
+
+	// Read the current timecodes
+	aja_timecode_get_ltc(card, &ltc);
+	aja_timecode_get_sdi1(card, &sdi1);
+	aja_timecode_get_sdi2(card, &sdi2);
+
+	for(i = 0; i < count; i++) {
+		int pg = done[i];
+		aja_stream_meta_t *meta = &card->stream.meta[pg];
+		if(card->thread.gen != gen) break;	// The stream restarted, these pages are gone
+		if(meta->audiolen && aja_acap_dma(card, pg, meta->audiolen)) {
+			meta->audiolen = 0;
+			meta->flags |= AJA_AudioDropped;
+		}
+		card->stream.meta[pg].tc[AJA_TimecodeSDI1] = sdi1;
+		card->stream.meta[pg].tc[AJA_TimecodeSDI2] = sdi2;
+		card->stream.meta[pg].tc[AJA_TimecodeLTC] = ltc;
+		aja_stream_fifo_push(card, pg);
+	}
+
+	// Pages captured meanwhile move up.  After a stream restart done holds the new
+	// stream's pages, so it is left alone
+	spin_lock_irqsave(&card->spin_reg, flags);
+	if(card->thread.gen == gen) {
+		card->thread.donect -= count;
+		memmove(card->thread.done, card->thread.done + count, card->thread.donect * sizeof(int));
+	}
+	spin_unlock_irqrestore(&card->spin_reg, flags);
+	return;
+}
+
 static int aja_stream_playback_frame(aja_card_t *card, int chan) {
 	int newp = 	aja_stream_fifo_pop(card);
-	aja_register_t 	reg = chan ? ajareg_ch2output : ajareg_ch1output;
 	if(newp < 0) return -ENOMEM;					// Buffer is dry
 	if(card->stream.meta[newp].chan != chan) {
 		perror("Page %d: expecting channel %d, got channel %d\n",
 			newp, chan, card->stream.meta[newp].chan);
 		return -EINVAL;	// Wrong channel
 	}
-	aja_prset(card, reg, newp);
+	if(chan) ajareg_set_ch2output(card, newp);
+	else ajareg_set_ch1output(card, newp);
 	card->stream.last[chan].type = AJA_Playback;
 	card->stream.last[chan].page = newp;
 	return newp;
@@ -1922,12 +3653,64 @@ static void aja_stream_drop(aja_card_t *card) {
 	return;
 }
 
+/* Moves the playlist on by one entry.  Returns 0 if the playlist has finished */
+static int aja_stream_playlist_advance(aja_playlist_t *pl) {
+	if(++pl->pos > pl->out) {
+		pl->pos = pl->in;
+		pl->pass++;
+		if(pl->loops && pl->pass >= pl->loops) {
+			pl->active = 0;
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/* Plays the next playlist entry.  The playlist pages are never freed or zeroed,
+ * so the same pages go to air pass after pass without any userspace interaction.
+ * When the last pass completes, the last entry stays on air and playback falls
+ * back to the fifo. */
+static void aja_stream_playlist_play(aja_card_t *card) {
+	int 		i, n, ret;
+	int 		chans = card->stream.chans;
+	int 		pages[AJA_MAXCHANS];
+	unsigned long 	flags;
+	aja_playlist_t 	*pl = &card->stream.playlist;
+
+	// Handle any TSO bumping (a count of 0 holds the current entry)
+	ret = aja_stream_speedcount(card);
+	if(!ret) return;
+
+	spin_lock_irqsave(&card->spin_reg, flags);
+	for(i = 1; i < ret; i++) {
+		if(!aja_stream_playlist_advance(pl)) {
+			spin_unlock_irqrestore(&card->spin_reg, flags);
+			return;
+		}
+	}
+	for(n = 0; n < chans; n++) pages[n] = pl->pages[pl->pos * chans + n];
+	aja_stream_playlist_advance(pl);
+	spin_unlock_irqrestore(&card->spin_reg, flags);
+
+	for(n = 0; n < chans; n++) {
+		if(n) ajareg_set_ch2output(card, pages[n]);
+		else ajareg_set_ch1output(card, pages[n]);
+	}
+	card->frame.time.priv = card->stream.meta[pages[0]].priv;
+	return;
+}
+
 static void aja_stream_playback(aja_card_t *card) {
 	int 		newp = 0, ret, i, n;
 	int 		chans = card->stream.chans;
 	timecode_t 	tc;
 	if(!(card->stream.flags & AJA_Playback)) return;
 
+	if(card->stream.playlist.active) {
+		aja_stream_playlist_play(card);
+		return;
+	}
+
 	if(atomic_read(&card->stream.fifo) < card->stream.chans) {
 		aja_stream_drop(card);
 		return;
@@ -1935,6 +3718,7 @@ static void aja_stream_playback(aja_card_t *card) {
 
 	// Handle any TSO bumping
 	ret = aja_stream_speedcount(card);
+	aja_afeed_bump(card, ret);
 	if(ret != 1) {
 		int bumpsize = ret - 1;
 		pinfo("%lld: playback bump %d\n", card->frame.id, bumpsize);
@@ -1983,7 +3767,8 @@ static void aja_stream_playback(aja_card_t *card) {
 static int aja_stream_capture_frame(aja_card_t *card, int chan) {
 	int newp = 	aja_stream_page_alloc(card);
 	if(newp < 0) return -ENOMEM;				// No more buffers
-	aja_prset(card, chan ? ajareg_ch2input : ajareg_ch1input, newp);
+	if(chan) ajareg_set_ch2input(card, newp);
+	else ajareg_set_ch1input(card, newp);
 	card->stream.last[chan].type = AJA_Capture;
 	card->stream.last[chan].page = newp;
 	return newp;
@@ -1993,12 +3778,25 @@ static void aja_stream_capture(aja_card_t *card) {
 	int 		n, ret;
 	int 		chans = card->stream.chans;
 	int 		newp = 0;
-	int 		inc;
+	int 		inc, held;
+	unsigned long 	flags;
 	if(!(card->stream.flags & AJA_Capture)) return;
 
-	if(card->stream.pagect - atomic_read(&card->stream.fifo) <= chans) {
-		aja_stream_drop(card);
-		return;
+	// The audio of this frame is sliced off at the start of the next one
+	if(card->stream.flags & AJA_CaptureAudio) card->acapring.due = 1;
+
+	// Captured pages the IRQ thread hasn't put on the fifo yet aren't free either
+	spin_lock_irqsave(&card->spin_reg, flags);
+	held = card->thread.donect;
+	spin_unlock_irqrestore(&card->spin_reg, flags);
+
+	if(card->stream.pagect - held - atomic_read(&card->stream.fifo) <= chans) {
+		// In ring mode the oldest frame makes room for the new one
+		int keep = (card->stream.pagect - held - 1) / chans - 2;
+		if(!card->stream.ring || keep < 0 || !aja_stream_fifo_trim(card, keep)) {
+			aja_stream_drop(card);
+			return;
+		}
 	}
 
 	// Figure out how many frames to bump.
@@ -2031,16 +3829,433 @@ static void aja_stream_capture(aja_card_t *card) {
 	return;
 }
 
-static void aja_handle_frame(aja_card_t *card, uint32_t timer) {
-	uint32_t line = aja_prget(card, ajareg_outputline);
-	uint32_t field = aja_prget(card, ajareg_outputfield);
+/* Adds a sample to a fit window.  Returns the number of samples in it */
+static int aja_clockwin_add(aja_clockwin_t *w, int64_t id, uint64_t count, int64_t mono) {
+	aja_clocksample_t *s = &w->sample[w->head];
+	s->id = id;
+	s->count = count;
+	s->mono = mono;
+	w->head = (w->head + 1) % AJA_CLOCKSYNC_SAMPLES;
+	if(w->samples < AJA_CLOCKSYNC_SAMPLES) w->samples++;
+	return w->samples;
+}
+
+/* The i'th oldest sample of a window */
+static inline aja_clocksample_t *aja_clockwin_get(aja_clockwin_t *w, int i) {
+	return &w->sample[(w->head + AJA_CLOCKSYNC_SAMPLES - w->samples + i) % AJA_CLOCKSYNC_SAMPLES];
+}
+
+/* Least squares fit of the frame times against the frame IDs.  The sums are taken
+ * relative to the oldest sample and scaled by n, so they stay inside 64 bits */
+static void aja_clockfit_frames(aja_clockwin_t *w, aja_clocksync_t *cs) {
+	aja_clocksample_t 	*first = aja_clockwin_get(w, 0);
+	aja_clocksample_t 	*last = aja_clockwin_get(w, w->samples - 1);
+	aja_clocksample_t 	*p;
+	int64_t 		n = w->samples, x, y, d;
+	int64_t 		sx = 0, sy = 0, sxx = 0, sxy = 0;
+	int 			i;
+
+	for(i = 0; i < n; i++) {
+		p = aja_clockwin_get(w, i);
+		x = p->id - first->id;
+		y = p->mono - first->mono;
+		sx += x; sy += y; sxx += x * x; sxy += x * y;
+	}
+	sxx = n * sxx - sx * sx;
+	sxy = n * sxy - sx * sy;
+	if(!sxx) return;
+
+	x = last->id - first->id;
+	cs->samples = n;
+	cs->period = div64_s64(sxy << 16, sxx);
+	cs->id = last->id;
+	cs->id_mono = first->mono + div64_s64(sy + (((n * x - sx) * cs->period) >> 16), n);
+	cs->residual = 0;
+	for(i = 0; i < n; i++) {
+		p = aja_clockwin_get(w, i);
+		d = p->mono - cs->id_mono - (((p->id - cs->id) * cs->period) >> 16);
+		if(d < 0) d = -d;
+		if(d > cs->residual) cs->residual = d;
+	}
+	return;
+}
+
+/* Least squares fit of the 48KHz counter against the system clock.  This works on
+ * the distance from the nominal rate, r = 3 * (t - count * 62500 / 3), so only the
+ * drift needs a division.  The counter only moves in 20.8us steps, so these samples
+ * are spread AJA_CLOCKSYNC_DECIMATE frames apart for a longer baseline */
+static void aja_clockfit_counter(aja_clockwin_t *w, aja_clocksync_t *cs) {
+	aja_clocksample_t 	*first = aja_clockwin_get(w, 0);
+	aja_clocksample_t 	*last = aja_clockwin_get(w, w->samples - 1);
+	aja_clocksample_t 	*p;
+	int64_t 		n = w->samples, d, y, r;
+	int64_t 		sd = 0, sy = 0, sr = 0, sdd = 0, sdr = 0;
+	int 			i;
+
+	for(i = 0; i < n; i++) {
+		p = aja_clockwin_get(w, i);
+		d = (int64_t)(p->count - first->count);
+		y = p->mono - first->mono;
+		r = 3 * y - 62500 * d;
+		sd += d; sy += y; sr += r; sdd += d * d; sdr += d * r;
+	}
+	sdd = n * sdd - sd * sd;
+	sdr = n * sdr - sd * sr;
+	if(sdd < 128) return;	// Counter isn't running
+
+	// drift (ppb) = 16000 * sdr / sdd
+	d = (int64_t)(last->count - first->count);
+	cs->drift = (int32_t)div64_s64(sdr * 125, sdd >> 7);
+	cs->count = last->count;
+	cs->count_mono = first->mono + div64_s64(sy + div64_s64((n * d - sd) * (NSEC_PER_SEC + cs->drift), 48000), n);
+	return;
+}
+
+/* Adds the frame to the clock fits and publishes the new estimate */
+static void aja_clockfit_sample(aja_card_t *card, int64_t id, uint32_t timer, int64_t mono) {
+	aja_clockfit_t 		*cf = &card->clockfit;
+	aja_clocksync_t 	cs = cf->sync;
+	uint64_t 		count = cf->count + (uint32_t)(timer - cf->timer);
+	unsigned long 		flags;
+
+	// A gap in the IRQs starts over
+	if(mono - cf->last > NSEC_PER_SEC / 5) {
+		cf->frames.samples = 0;
+		cf->counter.samples = 0;
+		cf->decimate = 0;
+	}
+	cf->last = mono;
+
+	if(aja_clockwin_add(&cf->frames, id, count, mono) >= 4) aja_clockfit_frames(&cf->frames, &cs);
+	if(!cf->decimate--) {
+		cf->decimate = AJA_CLOCKSYNC_DECIMATE - 1;
+		if(aja_clockwin_add(&cf->counter, id, count, mono) >= 4) aja_clockfit_counter(&cf->counter, &cs);
+	}
+
+	spin_lock_irqsave(&card->spin_reg, flags);
+	cf->count = count;
+	cf->timer = timer;
+	cf->sync = cs;
+	spin_unlock_irqrestore(&card->spin_reg, flags);
+	return;
+}
+
+#ifdef AJA_ALSA
+/*****************************************************************************/
+/* ALSA                                                                      */
+/*****************************************************************************/
+
+static struct snd_pcm_hardware aja_pcm_hw = {
+	.info 			= SNDRV_PCM_INFO_MMAP | SNDRV_PCM_INFO_MMAP_VALID |
+				  SNDRV_PCM_INFO_INTERLEAVED | SNDRV_PCM_INFO_BLOCK_TRANSFER,
+	.formats 		= SNDRV_PCM_FMTBIT_S32_LE,
+	.rates 			= SNDRV_PCM_RATE_48000,
+	.rate_min 		= AJA_AUDIO_RATE,
+	.rate_max 		= AJA_AUDIO_RATE,
+	.channels_min 		= 6,
+	.channels_max 		= 16,
+	.buffer_bytes_max 	= AJA_APLAY_CARDSIZE / 2,
+	.period_bytes_min 	= PAGE_SIZE,
+	.period_bytes_max 	= AJA_APLAY_CARDSIZE / 4,
+	.periods_min 		= 2,
+	.periods_max 		= 64
+};
+
+/* The channel count follows the card setup, so it is fixed for the open */
+/* A capture stream with AJA_TriggerAudio, armed or running, resets the card audio
+ * capture itself, so the ALSA capture stays out of its way */
+static int aja_stream_owns_acap(aja_card_t *card) {
+	if(!(card->stream.flags & AJA_Capture) || !(card->stream.flags & AJA_TriggerAudio)) return 0;
+	return atomic_read(&card->stream.running) || card->stream.trigger;
+}
+
+static int aja_pcm_open(struct snd_pcm_substream *ss) {
+	aja_card_t 		*card = snd_pcm_substream_chip(ss);
+	aja_pcmstream_t 	*ps = &card->alsa.stream[ss->stream];
+	struct snd_pcm_runtime 	*rt = ss->runtime;
+
+	if(ss->stream == SNDRV_PCM_STREAM_PLAYBACK && card->afeed.running) return -EBUSY;
+	if(ss->stream == SNDRV_PCM_STREAM_CAPTURE && aja_stream_owns_acap(card)) return -EBUSY;
+	rt->hw = aja_pcm_hw;
+	rt->hw.channels_min = rt->hw.channels_max = aja_audio_channels(card);
+
+	// The buffer is walked a page at a time by the ring DMA
+	snd_pcm_hw_constraint_step(rt, 0, SNDRV_PCM_HW_PARAM_BUFFER_BYTES, PAGE_SIZE);
+	// A stop from the last open the frame upkeep hasn't seen yet still has to happen
+	if(ps->state != AJA_PcmStopping) ps->state = AJA_PcmStopped;
+	ps->substream = ss;
+	return 0;
+}
+
+static int aja_pcm_close(struct snd_pcm_substream *ss) {
+	aja_card_t *card = snd_pcm_substream_chip(ss);
+	card->alsa.stream[ss->stream].substream = NULL;
+	return 0;
+}
+
+static int aja_pcm_hw_params(struct snd_pcm_substream *ss, struct snd_pcm_hw_params *hw) {
+	aja_card_t 		*card = snd_pcm_substream_chip(ss);
+	aja_pcmstream_t 	*ps = &card->alsa.stream[ss->stream];
+	int 			dir = ss->stream == SNDRV_PCM_STREAM_PLAYBACK ? PCI_DMA_TODEVICE : PCI_DMA_FROMDEVICE;
+	int 			ret;
+
+	ret = snd_pcm_lib_malloc_pages(ss, params_buffer_bytes(hw));
+	if(ret < 0) return ret;
+
+	down(&card->alsa.lock);
+	aja_hostring_free(card, &ps->ring);
+	ret = aja_hostring_view(&ps->ring, ss->runtime->dma_addr, ss->runtime->dma_bytes, dir);
+	if(!ret) aja_audio_dma_claim(card);
+	up(&card->alsa.lock);
+	return ret;
+}
+
+static int aja_pcm_hw_free(struct snd_pcm_substream *ss) {
+	aja_card_t *card = snd_pcm_substream_chip(ss);
+	down(&card->alsa.lock);
+	aja_hostring_free(card, &card->alsa.stream[ss->stream].ring);
+	up(&card->alsa.lock);
+	return snd_pcm_lib_free_pages(ss);
+}
+
+static int aja_pcm_prepare(struct snd_pcm_substream *ss) {
+	aja_card_t 		*card = snd_pcm_substream_chip(ss);
+	aja_pcmstream_t 	*ps = &card->alsa.stream[ss->stream];
+	down(&card->alsa.lock);
+	ps->pos = 0;
+	ps->period = 0;
+	ps->cardpos = 0;
+	up(&card->alsa.lock);
+	return 0;
+}
+
+static int aja_pcm_trigger(struct snd_pcm_substream *ss, int cmd) {
+	aja_card_t 		*card = snd_pcm_substream_chip(ss);
+	aja_pcmstream_t 	*ps = &card->alsa.stream[ss->stream];
+	switch(cmd) {
+		case SNDRV_PCM_TRIGGER_START:
+			if(ss->stream == SNDRV_PCM_STREAM_CAPTURE && aja_stream_owns_acap(card)) return -EBUSY;
+			ps->state = AJA_PcmStarting;
+			break;
+		case SNDRV_PCM_TRIGGER_STOP:	ps->state = AJA_PcmStopping; break;
+		default:			return -EINVAL;
+	}
+	return 0;
+}
+
+/* The position is what has been moved between the ALSA buffer and the card */
+/* The position is the bytes DMA'd to or from the buffer, which moves once a frame.
+ * The 48KHz counter would report samples the ring DMA hasn't moved yet */
+static snd_pcm_uframes_t aja_pcm_pointer(struct snd_pcm_substream *ss) {
+	aja_card_t *card = snd_pcm_substream_chip(ss);
+	return bytes_to_frames(ss->runtime, card->alsa.stream[ss->stream].pos);
+}
+
+static struct snd_pcm_ops aja_pcm_ops = {
+	.open 		= aja_pcm_open,
+	.close 		= aja_pcm_close,
+	.ioctl 		= snd_pcm_lib_ioctl,
+	.hw_params 	= aja_pcm_hw_params,
+	.hw_free 	= aja_pcm_hw_free,
+	.prepare 	= aja_pcm_prepare,
+	.trigger 	= aja_pcm_trigger,
+	.pointer 	= aja_pcm_pointer
+};
+
+/* Moves the ALSA buffer position on by 'n' bytes.  Returns 1 if a period elapsed */
+static int aja_alsa_advance(aja_pcmstream_t *ps, uint32_t n) {
+	struct snd_pcm_runtime 	*rt = ps->substream->runtime;
+	uint32_t 		period = frames_to_bytes(rt, rt->period_size);
+
+	ps->pos = (ps->pos + n) % frames_to_bytes(rt, rt->buffer_size);
+	ps->period += n;
+	if(ps->period < period) return 0;
+	ps->period %= period;
+	return 1;
+}
+
+/* Moves the audio captured since the last frame into the ALSA buffer */
+static int aja_alsa_capture(aja_card_t *card, aja_pcmstream_t *ps, aja_dma_t *dma, int atomic) {
+	struct snd_pcm_runtime 	*rt = ps->substream->runtime;
+	uint32_t 		csize = AJA_ACAP_CARDSIZE;
+	uint32_t 		fb = frames_to_bytes(rt, 1);
+	uint32_t 		cur, n, coff;
+	aja_sglist_t 		*end;
+	int 			ret;
+
+	if(ps->state == AJA_PcmStarting) {
+		if(!aja_prget(card, ajareg_acapenable)) aja_acap_start(card);
+		ps->state = AJA_PcmRunning;
+		cur = aja_prget(card, ajareg_acaplast) % csize;
+		ps->cardpos = cur - cur % fb;
+		return 0;
+	}
+
+	cur = aja_prget(card, ajareg_acaplast) % csize;
+	cur -= cur % fb;
+	n = min_t(uint32_t, (cur + csize - ps->cardpos) % csize, frames_to_bytes(rt, rt->buffer_size) / 2);
+	n -= n % fb;
+	if(!n) return 0;
+
+	coff = ps->cardpos;
+	end = aja_hostring_sg(card, dma, dma->list, &ps->ring, ps->pos, card->caps->acapbuf, csize, &coff, n);
+	if(end == NULL) return -ENOMEM;
+	ret = aja_hostring_run(card, dma, end, atomic);
+	if(ret) return ret;
+	ps->cardpos = coff;
+	return aja_alsa_advance(ps, n);
+}
+
+/* Tops the card playback buffer up to two periods from the ALSA buffer */
+static int aja_alsa_playback(aja_card_t *card, aja_pcmstream_t *ps, aja_dma_t *dma, int atomic) {
+	struct snd_pcm_runtime 	*rt = ps->substream->runtime;
+	uint32_t 		csize = AJA_APLAY_CARDSIZE;
+	uint32_t 		fb = frames_to_bytes(rt, 1);
+	uint32_t 		target = min_t(uint32_t, 2 * frames_to_bytes(rt, rt->period_size), csize / 2);
+	uint32_t 		rd, level, n, coff;
+	aja_sglist_t 		*end;
+	int 			ret, elapsed = 0;
+
+	if(ps->state == AJA_PcmStarting) {
+		// Prime the card from the start of its buffer before it plays
+		aja_aplay_stop(card);
+		ps->cardpos = 0;
+		rd = 0;
+	} else {
+		rd = aja_prget(card, ajareg_aplaylast) % csize;
+	}
+
+	level = (ps->cardpos + csize - rd) % csize;
+	n = level < target ? target - level : 0;
+	n = min_t(uint32_t, n, frames_to_bytes(rt, snd_pcm_playback_hw_avail(rt)));
+	n -= n % fb;
+	if(n) {
+		coff = ps->cardpos;
+		end = aja_hostring_sg(card, dma, dma->list, &ps->ring, ps->pos, card->caps->aplaybuf, csize, &coff, n);
+		if(end == NULL) return -ENOMEM;
+		ret = aja_hostring_run(card, dma, end, atomic);
+		if(ret) return ret;
+		ps->cardpos = coff;
+		elapsed = aja_alsa_advance(ps, n);
+	}
+
+	if(ps->state == AJA_PcmStarting) {
+		aja_aplay_start(card);
+		ps->state = AJA_PcmRunning;
+	}
+	return elapsed;
+}
+
+/* Stops the card side of a stream.  This needs neither the substream nor its
+ * buffer, which may already be gone by the time the stop is seen */
+static void aja_alsa_stop(aja_card_t *card, aja_pcmstream_t *ps, int dir) {
+	if(dir == SNDRV_PCM_STREAM_PLAYBACK) {
+		aja_aplay_stop(card);
+	} else if(!atomic_read(&card->stream.running) || !(card->stream.flags & AJA_Capture)) {
+		// A capture stream may still be using the card capture
+		aja_acap_stop(card);
+	}
+	ps->state = AJA_PcmStopped;
+	return;
+}
+
+/* Per frame PCM upkeep, from the IRQ thread.  The transfers happen once a frame, so
+ * the periods are reported from the output frame interrupt */
+static void aja_alsa_frame(aja_card_t *card) {
+	aja_alsa_t 			*al = &card->alsa;
+	aja_dma_t 			*dma = &card->dma[AJA_AUDIO_DMA];
+	struct snd_pcm_substream 	*elapsed[2] = { NULL, NULL };
+	aja_pcmstream_t 		*ps;
+	int 				i, atomic = in_interrupt();
+
+	if(al->pcm == NULL) return;
+	if(al->stream[0].state == AJA_PcmStopped && al->stream[1].state == AJA_PcmStopped) return;
+	if(aja_hostring_lock(&al->lock, dma, atomic)) return;
+
+	for(i = 0; i < 2; i++) {
+		ps = &al->stream[i];
+		if(ps->state == AJA_PcmStopping) {
+			aja_alsa_stop(card, ps, i);
+			continue;
+		}
+		if(ps->substream == NULL || ps->state == AJA_PcmStopped || ps->ring.bus == NULL) continue;
+		if(i == SNDRV_PCM_STREAM_PLAYBACK) {
+			if(aja_alsa_playback(card, ps, dma, atomic) > 0) elapsed[i] = ps->substream;
+		} else {
+			if(aja_alsa_capture(card, ps, dma, atomic) > 0) elapsed[i] = ps->substream;
+		}
+	}
+	aja_hostring_unlock(&al->lock, dma);
+
+	// Outside the lock, ALSA may call straight back into the PCM
+	for(i = 0; i < 2; i++) {
+		if(elapsed[i]) snd_pcm_period_elapsed(elapsed[i]);
+	}
+	return;
+}
+
+static void aja_alsa_register(aja_card_t *card) {
+	struct snd_card 	*sc;
+	struct snd_pcm 		*pcm;
+	int 			err;
+
+	init_MUTEX(&card->alsa.lock);
+	if(!alsa) return;
+
+	err = SND_CARD_CREATE(SNDRV_DEFAULT_IDX1, card->name, THIS_MODULE, 0, &sc);
+	if(err < 0) {
+		perror("%s: couldn't create the ALSA card [error %d]\n", card->name, err);
+		return;
+	}
+	snd_card_set_dev(sc, &card->pcidev->dev);
+	strcpy(sc->driver, MODNAME);
+	snprintf(sc->shortname, sizeof(sc->shortname), "AJA %s", card->name);
+	snprintf(sc->longname, sizeof(sc->longname), "AJA %s at %s irq %d", card->name, pci_name(card->pcidev), card->pcidev->irq);
+
+	err = snd_pcm_new(sc, card->name, 0, 1, 1, &pcm);
+	if(err < 0) goto alsa_fail;
+	pcm->private_data = card;
+	snprintf(pcm->name, sizeof(pcm->name), "AJA %s", card->name);
+	snd_pcm_set_ops(pcm, SNDRV_PCM_STREAM_PLAYBACK, &aja_pcm_ops);
+	snd_pcm_set_ops(pcm, SNDRV_PCM_STREAM_CAPTURE, &aja_pcm_ops);
+	snd_pcm_lib_preallocate_pages_for_all(pcm, SNDRV_DMA_TYPE_DEV, snd_dma_pci_data(card->pcidev),
+		64 * 1024, AJA_APLAY_CARDSIZE / 2);
+
+	err = snd_card_register(sc);
+	if(err < 0) goto alsa_fail;
+	card->alsa.card = sc;
+	card->alsa.pcm = pcm;
+	pinfo("%s: audio registered as ALSA card %d\n", card->name, sc->number);
+	return;
+
+alsa_fail:
+	perror("%s: couldn't register the ALSA PCM [error %d]\n", card->name, err);
+	snd_card_free(sc);
+	return;
+}
+
+static void aja_alsa_unregister(aja_card_t *card) {
+	if(card->alsa.card) snd_card_free(card->alsa.card);
+	card->alsa.card = NULL;
+	card->alsa.pcm = NULL;
+	return;
+}
+#endif
+
+static void aja_handle_frame(aja_card_t *card, uint32_t timer, int64_t mono, uint32_t istat) {
+	uint32_t line = ajareg_get_outputline(card);
+	uint32_t field = (istat & ajareg_outputfield.mask) >> ajareg_outputfield.shift;
 	int64_t id, trig = card->stream.trigger;
+	unsigned long flags;
 
 	/* If this is the start of a new frame, update the frame count */
 	if(!field) {
 		int ltcsync = 1;
 		int srun = atomic_read(&card->stream.running);
-		timecode_t curtc, ntc;
+		timecode_t curtc, ntc, ltc;
+
+		// Apply any register writes queued for this frame
+		if(card->regq.count) aja_registerv_apply(card);
 
 		// Increment the counters
 		card->frame.id++;
@@ -2057,7 +4272,9 @@ static void aja_handle_frame(aja_card_t *card, uint32_t timer) {
 		card->frame.time.id = id;
 		card->frame.time.line = line;
 		card->frame.time.timer = timer;
+		card->frame.time.mono = mono;
 		do_gettimeofday(&card->frame.time.tstamp);
+		aja_clockfit_sample(card, id, timer, mono);
 		
 		// Free up the previous frame
 		aja_stream_freeup(card);
@@ -2065,8 +4282,15 @@ static void aja_handle_frame(aja_card_t *card, uint32_t timer) {
 		// Handle the streams
 		if(srun) {
 			if(card->stream.atrig) {
-				if(card->stream.flags & AJA_Capture) aja_acap_start(card);
-				if(card->stream.flags & AJA_Playback) aja_aplay_start(card);
+				if(card->stream.flags & AJA_Capture) {
+					aja_acap_start(card);
+					aja_acapring_anchor(&card->acapring, 0);
+					card->avmon.cap.valid = 0;
+				}
+				if(card->stream.flags & AJA_Playback) {
+					aja_aplay_start(card);
+					card->avmon.play.valid = 0;
+				}
 				card->stream.atrig = 0;
 			}
 			aja_stream_playback(card);
@@ -2075,9 +4299,10 @@ static void aja_handle_frame(aja_card_t *card, uint32_t timer) {
 
 		// The current timecode isn't valid until this point as it may be altered by the
 		// stream capture/playback
-		ntc = curtc = card->tcg.value;
+		ntc = curtc = ltc = card->tcg.value;
 		if(srun) timecode_inc(&ntc);
 		card->frame.time.tcg = curtc;
+		aja_frameclock_update(card, srun);
 
 		// Since 60/50 fps timecode doesn't exist over the wire, we need
 		// to convert it to 30/25 fps timecode.  We then mark the odd frames
@@ -2088,23 +4313,26 @@ static void aja_handle_frame(aja_card_t *card, uint32_t timer) {
 		timecode_makevalidwire(&ntc);
 
 		// Update the output timecode
-		aja_timecode_set_sdi1(card, &ntc);
-		aja_timecode_set_sdi2(card, &ntc);
+		card->ops.sdi_tc(card, &ntc);
 
-		// Sync the LTC board
+		// Sync the LTC board.  The generator should be showing the timecode of
+		// the next sync by the time it comes, the worker takes care of that.
 		if(card->pcitc && ltcsync) {
-			aja_timecode_set_ltc(card, &curtc);
-			pcitc.sync(card->pcitc, 1); 
+			pcitc.sync(card->pcitc, 1);
 			pcitc.sync(card->pcitc, 0);
+			if(atomic_read(&card->tcg.flags) & AJA_TCG_Running) {
+				timecode_inc(&ltc);
+				if(ltc.fps > 30) timecode_inc(&ltc);
+			}
+			timecode_makevalidwire(&ltc);
+			aja_timecode_queue_ltc(card, &ltc);
 		}
 
-		// Update the P2 slave device
-		if(card->p2slave) { 
-			p2slave_set_tc(card->p2slave, &curtc);
-		}
-
-		// Wake up anyone waiting on a new frame
-		wake_up_all(&card->frame.wait);
+		// Everything else is left for the IRQ thread
+		spin_lock_irqsave(&card->spin_reg, flags);
+		card->thread.tc = curtc;
+		spin_unlock_irqrestore(&card->spin_reg, flags);
+		set_bit(AJA_ThreadFrame, &card->thread.pending);
 
 	} else {
 		if(atomic_read(&card->tcg.flags) & AJA_TCG_Running) {
@@ -2129,6 +4357,163 @@ static void aja_handle_frame(aja_card_t *card, uint32_t timer) {
 	return;
 }
 
+/* The slow half of the frame handling.  Called from the IRQ thread once the
+ * hard IRQ has flipped the pages */
+static void aja_handle_frame_thread(aja_card_t *card) {
+	timecode_t 	tc;
+	unsigned long 	flags;
+
+	spin_lock_irqsave(&card->spin_reg, flags);
+	tc = card->thread.tc;
+	spin_unlock_irqrestore(&card->spin_reg, flags);
+
+	// Wake up anyone waiting on a new frame first, the audio DMA below can take a while
+	wake_up_all(&card->frame.wait);
+	wake_up_all(&card->frame.until);
+
+	// Queue up the captured frames
+	aja_stream_capture_done(card);
+
+	// Keep the card audio topped up
+	aja_afeed_frame(card);
+#ifdef AJA_ALSA
+	aja_alsa_frame(card);
+#endif
+
+	// Update the P2 slave device
+	if(card->p2slave) {
+		p2slave_set_tc(card->p2slave, &tc);
+	}
+	return;
+}
+
+/* Threaded half of the IRQ handler.  Runs as a SCHED_FIFO kernel thread */
+irqreturn_t aja_irq_thread(int irq, void *dev_id) {
+	aja_card_t 	*card = (aja_card_t *)dev_id;
+	aja_timing_t 	*t = &card->thread.timing;
+	int64_t 	st, et;
+	unsigned long 	flags;
+
+	if(!test_and_clear_bit(AJA_ThreadFrame, &card->thread.pending)) return IRQ_NONE;
+
+	st = ktime_to_ns(ktime_get());
+	aja_handle_frame_thread(card);
+	et = ktime_to_ns(ktime_get());
+
+	spin_lock_irqsave(&card->spin_reg, flags);
+	t->thread_last = (uint32_t)(et - st);
+	if(t->thread_last > t->thread_max) t->thread_max = t->thread_last;
+	if(st - card->thread.tstamp > t->latency_max) t->latency_max = (uint32_t)(st - card->thread.tstamp);
+	spin_unlock_irqrestore(&card->spin_reg, flags);
+	return IRQ_HANDLED;
+}
+
+/* Handles the vertical and audio IRQ sources from a reg 21 snapshot.  Returns the
+ * reg 20 bits that clear them */
+static uint32_t aja_irq_video(aja_card_t *card, uint32_t istat) {
+	uint32_t iclr = 0;
+
+	/* Output Vertical IRQ */
+	if (istat & ajareg_outputirq.mask) {
+		uint32_t timer = ajareg_get_audiocount(card);
+		int64_t mono = rawclock_ns();
+		card->irqcount[AJA_Output]++;
+		iclr |= ajareg_outputirqclear.mask;
+		aja_handle_frame(card, timer, mono, istat);
+	}
+
+	/* Input Vertical IRQs */
+	if (istat & ajareg_input1irq.mask) {
+		card->irqcount[AJA_Input1]++;
+		iclr |= ajareg_input1irqclear.mask;
+	}
+	if (istat & ajareg_input2irq.mask) {
+		card->irqcount[AJA_Input2]++;
+		iclr |= ajareg_input2irqclear.mask;
+	}
+
+	/* Audio Wrap */
+	if (istat & ajareg_audiowrapirq.mask) {
+		card->irqcount[AJA_AudioWrap]++;
+		iclr |= ajareg_audiowrapirqclear.mask;
+	}
+
+	/* Handle possible legacy interrupts - we don't do anything with these */
+	if (istat & ajareg_audioirq.mask) iclr |= ajareg_audioirqclear.mask;
+	if (istat & ajareg_aplaywrapirq.mask) iclr |= ajareg_aplaywrapirqclear.mask;
+	if (istat & ajareg_acapwrapirq.mask) iclr |= ajareg_acapwrapirqclear.mask;
+	return iclr;
+}
+
+/* Same as above, plus the UART on the boards that have one */
+static uint32_t aja_irq_video_serial(aja_card_t *card, uint32_t istat) {
+	uint32_t iclr = aja_irq_video(card, istat);
+	unsigned long flags;
+
+	if (istat & ajareg_audiowrapirq.mask) {
+		/* Housekeeping functions.  Rx timeouts are handled by aja_slavepkt_timeout() */
+		if(card->flags & AJA_ResetUART) {
+			perror("UART reset\n");
+			card->flags &= (~AJA_ResetUART);
+			aja_uart_enable(card, 1);
+		}
+	}
+
+	/* Before 2.6.35 the handler runs with local IRQs on, and the timeout hrtimer
+	 * takes the lock from hard IRQ context */
+	spin_lock_irqsave(&card->slavepkt.lock, flags);
+
+	/* UART Tx */
+	if (istat & ajareg_uarttxirq.mask) {
+		card->irqcount[AJA_UART_TX]++;
+		aja_slavepkt_tx(card);
+		iclr |= ajareg_uarttxirqclear.mask;
+	}
+
+	/* UART Rx */
+	if (istat & ajareg_uartrxirq.mask) {
+		card->irqcount[AJA_UART_RX]++;
+		aja_slavepkt_rx(card);
+		iclr |= ajareg_uartrxirqclear.mask;
+	}
+
+	spin_unlock_irqrestore(&card->slavepkt.lock, flags);
+	return iclr;
+}
+
+/* Board families */
+static const aja_boardops_t aja_ops_sd = {
+	.name = 	"SD",
+	.irq_video = 	aja_irq_video,
+	.dma_kick = 	aja_dma_kick32,
+	.sdi_tc = 	aja_timecode_set_sdi_small
+};
+
+static const aja_boardops_t aja_ops_hd = {
+	.name = 	"HD",
+	.irq_video = 	aja_irq_video,
+	.dma_kick = 	aja_dma_kick32,
+	.sdi_tc = 	aja_timecode_set_sdi
+};
+
+/* The K2 boards take the same paths, the driver has nothing K2 specific */
+static const aja_boardops_t aja_ops_hdserial = {
+	.name = 	"HD serial",
+	.irq_video = 	aja_irq_video_serial,
+	.dma_kick = 	aja_dma_kick32,
+	.sdi_tc = 	aja_timecode_set_sdi
+};
+
+/* Picks the board family operations.  Must be called once the DMA mode is known */
+static void aja_boardops_select(aja_card_t *card) {
+	int flags = card->caps->flags;
+	if(flags & AJA_SmallReg) card->ops = aja_ops_sd;
+	else if(flags & AJA_HasSerial) card->ops = aja_ops_hdserial;
+	else card->ops = aja_ops_hd;
+	if(card->flags & AJA_DMA64) card->ops.dma_kick = aja_dma_kick64;
+	return;
+}
+
 /* This function is called when ever the kernel detects that there was an interrupt on our irq line */
 #if LINUX_VERSION_CODE > KERNEL_VERSION(2,6,18)
 irqreturn_t aja_irq_service(int irq, void *dev_id) {
@@ -2136,149 +4521,92 @@ irqreturn_t aja_irq_service(int irq, void *dev_id) {
 irqreturn_t aja_irq_service(int irq, void *dev_id, struct pt_regs *regs) {
 #endif
 	aja_card_t *card = (aja_card_t *)dev_id;
-	int handled = 0;
-	/*
-	unsigned long long st, et;
-	rdtscll(st);
-	*/
+	int handled = 0, frame = 0;
+	int64_t st = ktime_to_ns(ktime_get());
 	
-	/* Now we need to determine if the card is the source of the interrupt.  If so handle it, if not ignore it */
+	uint32_t dstat, istat;
+	uint32_t dclr = 0, iclr = 0;
+
+	/* Now we need to determine if the card is the source of the interrupt.  If so handle it, if not ignore it.
+	 * The DMA and vertical status registers are only read once, and all the sources are decoded from that */
+	dstat = ajareg_get_dmastatus(card);
+
 	/* Bus Error IRQ */
-	if (unlikely(aja_prget(card, ajareg_buserrorirq))) {
+	if (unlikely(dstat & ajareg_buserrorirq.mask)) {
 		card->irqcount[AJA_BusError]++;
-		aja_prset(card, ajareg_buserrorirqclear, 1);
-		handled = 1;
+		dclr |= ajareg_buserrorirqclear.mask;
 		perror("Card %d: Bus Error!", card->index);
-		wake_up_all(&card->irqwait[AJA_BusError]);
 	}
-	
-	/* DMA4 IRQ */
-	if (aja_prget(card, ajareg_dma4irq)) {
+
+	/* DMA IRQs */
+	if (dstat & ajareg_dma4irq.mask) {
 		card->irqcount[AJA_DMA4]++;
-		aja_prset(card, ajareg_dma4irqclear, 1);
-		handled = 1;
-		wake_up_all(&card->irqwait[AJA_DMA4]);
+		dclr |= ajareg_dma4irqclear.mask;
 	}
-	
-	/* DMA3 IRQ */
-	if (aja_prget(card, ajareg_dma3irq)) {
+	if (dstat & ajareg_dma3irq.mask) {
 		card->irqcount[AJA_DMA3]++;
-		aja_prset(card, ajareg_dma3irqclear, 1);
-		handled = 1;
-		wake_up_all(&card->irqwait[AJA_DMA3]);
+		dclr |= ajareg_dma3irqclear.mask;
 	}
-	
-	/* DMA2 IRQ */
-	if (aja_prget(card, ajareg_dma2irq)) {
+	if (dstat & ajareg_dma2irq.mask) {
 		card->irqcount[AJA_DMA2]++;
-		aja_prset(card, ajareg_dma2irqclear, 1);
-		handled = 1;
-		wake_up_all(&card->irqwait[AJA_DMA2]);
+		dclr |= ajareg_dma2irqclear.mask;
 	}
-	
-	/* DMA1 IRQ */
-	if (aja_prget(card, ajareg_dma1irq)) {
+	if (dstat & ajareg_dma1irq.mask) {
 		card->irqcount[AJA_DMA1]++;
-		aja_prset(card, ajareg_dma1irqclear, 1);
+		dclr |= ajareg_dma1irqclear.mask;
+	}
+
+	/* Acknowledge the DMA sources with one write and wake the waiters */
+	if (dclr) {
+		aja_prwrite(card, ajareg_dma1irqclear.add, dclr, dclr);
 		handled = 1;
-		wake_up_all(&card->irqwait[AJA_DMA1]);	
+		if (dstat & ajareg_buserrorirq.mask) wake_up_all(&card->irqwait[AJA_BusError]);
+		if (dstat & ajareg_dma4irq.mask) wake_up_all(&card->irqwait[AJA_DMA4]);
+		if (dstat & ajareg_dma3irq.mask) wake_up_all(&card->irqwait[AJA_DMA3]);
+		if (dstat & ajareg_dma2irq.mask) wake_up_all(&card->irqwait[AJA_DMA2]);
+		if (dstat & ajareg_dma1irq.mask) wake_up_all(&card->irqwait[AJA_DMA1]);
 	}
 
 	/* We can only trust the status register if the VIV (dma reg, bit 26) bit is high  */
-	if (aja_prget(card, ajareg_viv)) {
-		uint32_t timer = aja_prget(card, ajareg_audiocount);
-
-		/* Output Vertical IRQ */
-		if (aja_prget(card, ajareg_outputirq)) {
-			card->irqcount[AJA_Output]++;
-			aja_prset(card, ajareg_outputirqclear, 1);
-			handled = 1;
-			aja_handle_frame(card, timer);
-			wake_up_all(&card->irqwait[AJA_Output]);
-		}
-
-		/* Check for all possible interrupt types, if we find one handle it!!! */
-		/* Input 1 Vertical IRQ */
-		if (aja_prget(card, ajareg_input1irq)) {
-			card->irqcount[AJA_Input1]++;
-			aja_prset(card, ajareg_input1irqclear, 1);
-			handled = 1;
-			wake_up_all(&card->irqwait[AJA_Input1]);
-		}
-	
-		/* Input 2 Vertical IRQ */		
-		if (aja_prget(card, ajareg_input2irq)) {
-			card->irqcount[AJA_Input2]++;
-			aja_prset(card, ajareg_input2irqclear, 1);
-			handled = 1;
-			wake_up_all(&card->irqwait[AJA_Input2]);
-		}
-			
-	
-		/* Audio Wrap */
-		if (aja_prget(card, ajareg_audiowrapirq)) {
-			card->irqcount[AJA_AudioWrap]++;
-			aja_prset(card, ajareg_audiowrapirqclear, 1);
-			
-			/* Check for a UART Rx timeout */
-			if(card->slavepkt.inpt && (card->slavepkt.tstamp + 2) < card->irqcount[AJA_AudioWrap]) {
-				perror("UART Rx timeout w/ %d bytes\n", card->slavepkt.inpt);
-				aja_slavepkt_reset(&card->slavepkt);
-				aja_uart_enable(card, 0);
-				card->flags |= AJA_ResetUART;
-			}
-
-			/* Housekeeping functions */
-			if(card->flags & AJA_ResetUART) {
-				perror("UART reset\n");
-				card->flags &= (~AJA_ResetUART);
-				aja_uart_enable(card, 1);
-			}
-			
-			wake_up_all(&card->irqwait[AJA_AudioWrap]);
-			handled = 1;
-		}
-
-		/* UART Tx */
-		if (aja_prget(card, ajareg_uarttxirq)) {
-			card->irqcount[AJA_UART_TX]++;
-			aja_slavepkt_tx(card);
-			aja_prset(card, ajareg_uarttxirqclear, 1);
-			wake_up_all(&card->irqwait[AJA_UART_TX]);
-			handled = 1;
-		}
+	if (dstat & ajareg_viv.mask) {
+		istat = ajareg_get_irqstatus(card);
 
-		/* UART Rx */
-		if (aja_prget(card, ajareg_uartrxirq)) {
-			card->irqcount[AJA_UART_RX]++;
-			aja_slavepkt_rx(card);
-			aja_prset(card, ajareg_uartrxirqclear, 1);
-			wake_up_all(&card->irqwait[AJA_UART_RX]);
-			handled = 1;
-		}
-
-		/* Handle possible legacy interrupts - we don't do anything with these */
-		if(aja_prget(card, ajareg_audioirq)) {
-			aja_prset(card, ajareg_audioirqclear, 1);
-			handled = 1;
-		}
+		iclr = card->ops.irq_video(card, istat);
+		frame = (iclr & ajareg_outputirqclear.mask) != 0;
 
-		if(aja_prget(card, ajareg_aplaywrapirq)) {
-			aja_prset(card, ajareg_aplaywrapirqclear, 1);
+		/* Acknowledge everything with one write and wake the waiters */
+		if (iclr) {
+			aja_prwrite(card, ajareg_outputirqclear.add, iclr, iclr);
 			handled = 1;
+			if (istat & ajareg_outputirq.mask) wake_up_all(&card->irqwait[AJA_Output]);
+			if (istat & ajareg_input1irq.mask) wake_up_all(&card->irqwait[AJA_Input1]);
+			if (istat & ajareg_input2irq.mask) wake_up_all(&card->irqwait[AJA_Input2]);
+			if (istat & ajareg_audiowrapirq.mask) wake_up_all(&card->irqwait[AJA_AudioWrap]);
+			if (istat & ajareg_uarttxirq.mask) wake_up_all(&card->irqwait[AJA_UART_TX]);
+			if (istat & ajareg_uartrxirq.mask) wake_up_all(&card->irqwait[AJA_UART_RX]);
 		}
+	}
 
-		if(aja_prget(card, ajareg_acapwrapirq)) {
-			aja_prset(card, ajareg_acapwrapirqclear, 1);
-			handled = 1;
-		}
-	
+	/* Only this card's output interrupt starts the thread and its timing, not an
+	 * IRQ of another device on the shared line */
+	if (frame && test_bit(AJA_ThreadFrame, &card->thread.pending)) {
+		aja_timing_t *t = &card->thread.timing;
+		int64_t et = ktime_to_ns(ktime_get());
+		unsigned long flags;
+		spin_lock_irqsave(&card->spin_reg, flags);
+		t->count++;
+		t->last = (uint32_t)(et - st);
+		if(t->last > t->max) t->max = t->last;
+		card->thread.tstamp = et;
+		spin_unlock_irqrestore(&card->spin_reg, flags);
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,30)
+		return IRQ_WAKE_THREAD;
+#else
+		// No threaded IRQs, so finish up here
+		aja_irq_thread(irq, dev_id);
+#endif
 	}
 
-	/*
-	rdtscll(et);
-	pinfo("IRQ took %llu cycles\n", et - st);
-	*/
 	if (handled) return IRQ_HANDLED;
 	return IRQ_NONE;
 }
@@ -2311,6 +4639,35 @@ static int aja_mmap(struct file *filp, struct vm_area_struct *vma) {
 	unsigned long 	regstart = 0;
 	unsigned long 	size = vma->vm_end - vma->vm_start;
 
+	// The frame clock page is read only
+	if(vma->vm_pgoff == AJA_MMAP_FRAMECLOCK) {
+		if(card->frame.clock == NULL) return -ENODEV;
+		if(size > PAGE_SIZE) return -EINVAL;
+		if(vma->vm_flags & VM_WRITE) return -EPERM;
+		vma->vm_flags &= ~VM_MAYWRITE;
+		vma->vm_flags |= VM_RESERVED;
+		if(remap_pfn_range(vma, vma->vm_start, virt_to_phys(card->frame.clock) >> PAGE_SHIFT, size, vma->vm_page_prot)) return -EAGAIN;
+		return 0;
+	}
+
+	// The captured audio ring is read only
+	if(vma->vm_pgoff == AJA_MMAP_AUDIO) {
+		int ret;
+		down(&card->acapring.lock);
+		ret = aja_hostring_mmap(&card->acapring.ring, vma, 0);
+		up(&card->acapring.lock);
+		return ret;
+	}
+
+	// The audio feeder ring is written by the producer
+	if(vma->vm_pgoff == AJA_MMAP_AFEED) {
+		int ret;
+		down(&card->afeed.lock);
+		ret = aja_hostring_mmap(&card->afeed.ring, vma, 1);
+		up(&card->afeed.lock);
+		return ret;
+	}
+
 	// WTF: Not sure why, but the aja card bus resources are 0, 2, and 4.
 	// I'm pretty sure that wasn't the case a while back.
 	switch(vma->vm_pgoff) {
@@ -2330,6 +4687,12 @@ static int aja_mmap(struct file *filp, struct vm_area_struct *vma) {
 			return -ENODEV;
 	}
 	if(!reglen || !regstart) return -ENODEV;
+	// The registers are read only too, writes go through the driver so the shadow
+	// stays right.  The frame and audio memory BARs stay writable
+	if(vma->vm_pgoff == 0) {
+		if(vma->vm_flags & VM_WRITE) return -EPERM;
+		vma->vm_flags &= ~VM_MAYWRITE;
+	}
 	vma->vm_flags |= VM_RESERVED;
 	pinfo("Mapping resource %ld - 0x%lX @ 0x%lX\n", vma->vm_pgoff, reglen, regstart);
 	if(remap_pfn_range(vma, vma->vm_start, regstart >> PAGE_SHIFT, size, vma->vm_page_prot)) return -EAGAIN;
@@ -2464,14 +4827,24 @@ static int aja_pci_probe(struct pci_dev *dev, const struct pci_device_id *id) {
 	if(dma64) card->flags |= AJA_DMA64;
 	card->reglen = reglen;
 	card->regadd = regadd;
+	aja_shadow_seed(card);
+	aja_boardops_select(card);
+
+	/* The UART inter-byte timeout, armed from the IRQ */
+	hrtimer_init(&card->slavepkt.timer, CLOCK_MONOTONIC, HRTIMER_MODE_REL);
+	card->slavepkt.timer.function = aja_slavepkt_timeout;
 	
-	pinfo("%s: %s [0x%X], PCIFW 0x%X, IRQ %d\n", 
+	pinfo("%s: %s [0x%X], PCIFW 0x%X, IRQ %d, %s family\n", 
 		pciname, card->caps->name, card->caps->id, 
-		pcifw, dev->irq);
+		pcifw, dev->irq, card->ops.name);
 	
 	/* Request the card IRQ from the kernel */
 	pdebug("%s: requesting IRQ\n", pciname);
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,30)
+	error = request_threaded_irq(dev->irq, aja_irq_service, aja_irq_thread, IRQF_SHARED, MODNAME, card);
+#else
 	error = request_irq(dev->irq, aja_irq_service, IRQF_SHARED, MODNAME, card);
+#endif
 	if(error) {
 		perror("%s: couldn't allocate the card IRQ. [error %d]\n", pciname, error);
 		goto err3;
@@ -2496,10 +4869,22 @@ static int aja_pci_probe(struct pci_dev *dev, const struct pci_device_id *id) {
 		if(card->pcitc) pinfo("%s: connected to LTC I/O %p\n", pciname, card->pcitc);
 	}
 
+	/* The LTC generator is kept up to date from a worker, not the IRQ */
+	if(card->pcitc) {
+		WORK_INIT(&card->ltc.work, aja_timecode_ltc_work);
+		card->ltc.wq = create_singlethread_workqueue(card->name);
+		if(card->ltc.wq == NULL) perror("%s: couldn't create the LTC worker\n", pciname);
+	}
+
 	/* Allocate a p2slave device for the card */
 	card->p2slave = p2slave_register(card->name);
 	if(card->p2slave == NULL) pinfo("Failed to register a p2slave device for %s\n", card->name);
 
+#ifdef AJA_ALSA
+	aja_alsa_register(card);
+#endif
+	aja_avmon_setup(card);
+
 	/* Ok, now increment the cardcount */
 	aja_cards++;
 	return 0;
@@ -2530,11 +4915,20 @@ static void aja_pci_remove(struct pci_dev *dev) {
 	pinfo("%s: removing card\n", pciname);
 
 	aja_irqset(card, 0);			/* Turn off the interrupts for this card */
+
+	/* Remove the IRQ, then the UART timeout it arms.  free_irq waits for the
+	 * handler and the IRQ thread, so nothing below is used from them after */
+	if (card->pcidev->irq) free_irq(card->pcidev->irq, card);
+	hrtimer_cancel(&card->slavepkt.timer);
+
+#ifdef AJA_ALSA
+	aja_alsa_unregister(card);		/* Remove the ALSA card */
+#endif
 	p2slave_unregister(card->p2slave);	/* Unregister the p2slave device */
 	aja_device_destroy(card);		/* remove the device from the class */
-	
-	/* Remove the IRQ */
-	if (card->pcidev->irq) free_irq(card->pcidev->irq, card);
+
+	/* Stop the LTC worker */
+	if (card->ltc.wq) destroy_workqueue(card->ltc.wq);
 	
 	/* Unmap and free the register space */
 	iounmap((void *)card->regadd);
@@ -2594,6 +4988,8 @@ static void aja_cleanup(void) {
 	if(ltcio_register) {
 		symbol_put(pcitc_register);
 	}
+
+	aja_regtrace_cleanup();
 	return;
 }	
 
@@ -2624,6 +5020,8 @@ static int __init aja_init(void) {
 	}
 	pdebug("Registered as char device %d\n", MAJOR(aja_chrdev));
 	
+	aja_regtrace_init();
+
 	/* Check to see if the PCI-TC board is installed */
 	memset(&pcitc, 0, sizeof(pcitc));
 	ltcio_register = symbol_get(pcitc_register);
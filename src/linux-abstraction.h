@@ -75,6 +75,84 @@ static inline void sg_set_page(struct scatterlist *sg, struct page *page, unsign
 
 #endif
 
+// Fix the workqueue system
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,20)
+#define WORK_FUNC(name, arg) void name(struct work_struct *arg)
+#define WORK_INIT(work, func) INIT_WORK(work, func)
+#else
+#define WORK_FUNC(name, arg) void name(void *arg)
+#define WORK_INIT(work, func) INIT_WORK(work, func, work)
+#endif
+
+// Fix the raw monotonic clock, older kernels only have the (slewed) monotonic clock
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,28)
+static inline int64_t rawclock_ns(void) {
+	struct timespec ts;
+	getrawmonotonic(&ts);
+	return timespec_to_ns(&ts);
+}
+#else
+static inline int64_t rawclock_ns(void) {
+	return ktime_to_ns(ktime_get());
+}
+#endif
+
+// Fix 64bit division.  The fallback drops divisor bits past 32, plenty for fits
+#if LINUX_VERSION_CODE < KERNEL_VERSION(2,6,26)
+static inline int64_t div64_s64(int64_t a, int64_t b) {
+	int neg = (a < 0) != (b < 0);
+	uint64_t ua = (a < 0) ? -a : a;
+	uint64_t ub = (b < 0) ? -b : b;
+	while(ub >> 32) {
+		ub >>= 1;
+		ua >>= 1;
+	}
+	do_div(ua, (uint32_t)ub);
+	return neg ? -(int64_t)ua : (int64_t)ua;
+}
+#endif
+
+// Fix the hrtimer mode names, renamed in 2.6.21
+#if LINUX_VERSION_CODE < KERNEL_VERSION(2,6,21)
+#define HRTIMER_MODE_REL HRTIMER_REL
+#endif
+
+// Fix the tty line discipline operations, split out of struct tty_ldisc in 2.6.27,
+// and the tty driver operations, moved out of the driver in 2.6.26
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,27)
+#define TTY_LDISC_T struct tty_ldisc_ops
+#else
+#define TTY_LDISC_T struct tty_ldisc
+#endif
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,26)
+#define TTY_WRITE(tty, buf, len) (tty)->ops->write(tty, buf, len)
+#else
+#define TTY_WRITE(tty, buf, len) (tty)->driver->write(tty, buf, len)
+#endif
+
+// Fix ACCESS_ONCE, added to compiler.h in 2.6.26
+#ifndef ACCESS_ONCE
+#define ACCESS_ONCE(x) (*(volatile typeof(x) *)&(x))
+#endif
+
+// Fix the power of 2 helpers, linux/log2.h appeared in 2.6.20
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,20)
+#include <linux/log2.h>
+#else
+static inline unsigned long roundup_pow_of_two(unsigned long n) {
+	unsigned long r = 1;
+	while(r < n) r <<= 1;
+	return r;
+}
+#endif
+
+// Fix the ALSA card creation
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,30)
+#define SND_CARD_CREATE(idx, id, mod, extra, cardp) snd_card_create(idx, id, mod, extra, cardp)
+#else
+#define SND_CARD_CREATE(idx, id, mod, extra, cardp) ((*(cardp) = snd_card_new(idx, id, mod, extra)) ? 0 : -ENOMEM)
+#endif
+
 
 
 #endif /* ifndef _LINUX_ABSTRACTION_H_ */
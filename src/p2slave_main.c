@@ -36,6 +36,10 @@
 #include <asm/uaccess.h>
 #include <linux/device.h>
 #include <linux/poll.h>
+#include <linux/mm.h>
+#include <linux/vmalloc.h>
+#include <linux/tty.h>
+#include <linux/tty_ldisc.h>
 
 #include <p2slave.h>
 #include "utils.h"
@@ -43,13 +47,17 @@
 
 #define MODNAME			"p2slave"
 #define MAX_DEVS		256
-#define P2SLAVE_BUFSIZE		128
+#define P2SLAVE_TTY_TIMEOUT 	10000000	/* ns, a gap this long between command bytes drops the command */
 
-#define FUNC_SET(name, type, dconv) 						\
+/* The setters rebuild the sense replies that depend on the value, see p2slave_build_tc() */
+#define FUNC_SET(name, type, dconv, build) 					\
 	void p2slave_set_##name(struct p2slave_t *dev, type data) {		\
 		unsigned long flags;						\
 		spin_lock_irqsave(&dev->datalock, flags);			\
+		write_seqcount_begin(&dev->seq);				\
 		dev->data.name = dconv;						\
+		build;								\
+		write_seqcount_end(&dev->seq);					\
 		spin_unlock_irqrestore(&dev->datalock, flags);			\
 		return;								\
 	}									\
@@ -66,37 +74,30 @@
 	}							\
 	EXPORT_SYMBOL(p2slave_get_##name)
 
-#define FUNC_GET_SMPTE(name)								\
-	static timecode_smpte_t p2slave_get_smpte_##name(struct p2slave_t *dev) {	\
-		timecode_t tc = p2slave_get_##name(dev);				\
-		return timecode_to_smpte(&tc);						\
-	}
-
-#define FUNC_GET_USER(name) 											\
-	static int p2slave_get_user_##name(struct p2slave_t *dev, unsigned long arg) {				\
-		unsigned long 	flags;										\
-		int		ret;										\
-		spin_lock_irqsave(&dev->datalock, flags);							\
-		ret = copy_from_user((void *)&dev->data.name, (const void *)arg, sizeof(dev->data.name));	\
-		spin_unlock_irqrestore(&dev->datalock, flags);							\
-		return ret;											\
+/* 'setarg' hands the copied value to the setter, 'val' or '&val' */
+#define FUNC_GET_USER(name, setarg) 									\
+	static int p2slave_get_user_##name(struct p2slave_t *dev, unsigned long arg) {			\
+		__typeof__(dev->data.name) val;								\
+		if(copy_from_user((void *)&val, (const void *)arg, sizeof(val))) return -EFAULT;	\
+		p2slave_set_##name(dev, setarg);							\
+		return 0;										\
 	}
 
 static int			chrdev = 0;
 static CLASS_T			*class = NULL;	/* class structure */ 
 static struct p2slave_t		*devs[MAX_DEVS];  /* Devices structure */
 static spinlock_t 		spinlock = SPIN_LOCK_UNLOCKED;
+static int 			ldisc = -1;		/* tty line discipline number, -1 = don't register */
+static int 			ldisc_registered = 0;
+static int 			ring_slots = 1024;	/* Packets in each device's ring, rounded up to a power of 2 */
+
+module_param(ldisc, int, S_IRUGO);
+module_param(ring_slots, int, S_IRUGO);
 
 MODULE_LICENSE("GPL");
 MODULE_AUTHOR("Jason Howard <jth@spectsoft.com>");
 MODULE_DESCRIPTION("Linux 2.6 driver for a Sony P2 slave");
 
-struct p2slave_buffer_t {
-	volatile int			read;	// Read Pointer
-	volatile int			write;	// Write Pointer
-	struct p2slave_pkt_t		buf[P2SLAVE_BUFSIZE];
-};
-
 struct p2slave_data_t {
 	uint16_t			id;
 	struct p2slave_status_t		status;
@@ -110,6 +111,31 @@ struct p2slave_data_t {
 	int 				speed;
 };
 
+/* Sense replies, built with their checksums by the setters so a command is
+ * answered with a copy */
+enum p2slave_reply {
+	P2R_DevType = 0,
+	P2R_GenTC,
+	P2R_GenUB,
+	P2R_GenTCUB,
+	P2R_LTC,
+	P2R_VITC,
+	P2R_Timer1,
+	P2R_LTCUB,
+	P2R_VITCUB,
+	P2R_LTCTCUB,
+	P2R_VITCTCUB,
+	P2R_In,
+	P2R_Out,
+	P2R_AudIn,
+	P2R_AudOut,
+	P2R_Speed,
+	P2R_Preroll,
+	P2R_Count
+};
+
+#define P2SLAVE_REPLYSIZE 	12	/* Largest sense reply, two words and the checksum */
+
 enum p2slave_flags {
 	P2S_Debug		= 0x0001	/* Output Packet Debug */
 };
@@ -117,6 +143,9 @@ enum p2slave_flags {
 struct p2slave_stat_t {
 	int 				count;	/* Number of packets */
 	int				err_crc; /* Number of CRC errors */
+	int 				err_line; /* Number of tty framing, parity and overrun errors */
+	int 				err_timeout; /* Number of part received tty commands dropped */
+	int 				overflows; /* Number of packets dropped because the ring was full */
 };
 
 struct p2slave_t {
@@ -126,9 +155,15 @@ struct p2slave_t {
 	struct p2slave_stat_t		stats;
 	atomic_t			opens;			// Number of opens
 	wait_queue_head_t		wait;			// Wait Queue
-	spinlock_t			datalock;
+	spinlock_t			datalock;		// Serializes the setters
+	seqcount_t 			seq;			// Bumped around every change to data and reply
 	struct p2slave_data_t		data;
-	struct p2slave_buffer_t		buffer;
+	uint8_t 			reply[P2R_Count][P2SLAVE_REPLYSIZE];
+	uint32_t 			tcword;			// SMPTE timecode word of data.tc
+	struct p2slave_ring_t 		*ring;			// Packet ring, shared with userspace
+	uint32_t 			ring_slots;		// Ring slots, the header copy is writable by userspace
+	uint32_t 			ring_bytes;		// Ring size, whole pages
+	uint32_t 			ring_write;		// Packets written, the header copy is writable by userspace
 	struct cdev			cdev;
 	struct device 			*device;
 };
@@ -140,52 +175,161 @@ struct p2slave_t {
 static const uint8_t pkt_ack[] 		= {0x10, 0x01};
 static const uint8_t pkt_nak_csum[]	= {0x11, 0x12, 0x04, 0x27};
 
-FUNC_SET(id, uint16_t, data);
+static uint8_t p2slave_checksum(const uint8_t *data, int size) {
+	int i;
+	uint8_t csum = 0;
+	for(i = 0; i < size; i++) csum += *data++;
+	return csum;
+}
+
+static void p2slave_checksum_add(uint8_t *data) {
+	int size = (data[0] & 0x0F) + 2; // This is the size BEFORE the checksum
+	uint8_t csum = p2slave_checksum(data, size);
+	data[size] = csum;
+	return;
+}
+
+static int p2slave_checksum_verify(const uint8_t *data) {
+	int size = (data[0] & 0x0F) + 2; // This is the size BEFORE the checksum
+	uint8_t csum = p2slave_checksum(data, size);
+	return(csum != data[size]);
+}
+
+/* Builds a sense reply of one or two 32bit words and adds its checksum */
+static void p2slave_reply_build(uint8_t *pout, uint8_t b1, uint8_t b2, uint32_t i1, uint32_t i2) {
+	pout[0] = b1;
+	pout[1] = b2;
+	pout[2] = i1 & 0xFF;
+	pout[3] = (i1 >> 8) & 0xFF;
+	pout[4] = (i1 >> 16) & 0xFF;
+	pout[5] = (i1 >> 24) & 0xFF;
+	pout[6] = i2 & 0xFF;
+	pout[7] = (i2 >> 8) & 0xFF;
+	pout[8] = (i2 >> 16) & 0xFF;
+	pout[9] = (i2 >> 24) & 0xFF;
+	p2slave_checksum_add(pout);
+	return;
+}
+
+static void p2slave_build_id(struct p2slave_t *dev) {
+	uint8_t *pout = dev->reply[P2R_DevType];
+	pout[0] = 0x12;
+	pout[1] = 0x11;
+	pout[2] = (dev->data.id >> 8) & 0xFF;
+	pout[3] = dev->data.id & 0xFF;
+	p2slave_checksum_add(pout);
+	return;
+}
+
+static void p2slave_build_tcgen(struct p2slave_t *dev) {
+	timecode_smpte_t stc = timecode_to_smpte(&dev->data.tcgen);
+	p2slave_reply_build(dev->reply[P2R_GenTC], 0x74, 0x08, stc.timecode, 0);
+	p2slave_reply_build(dev->reply[P2R_GenUB], 0x74, 0x09, stc.userbits, 0);
+	p2slave_reply_build(dev->reply[P2R_GenTCUB], 0x78, 0x08, stc.timecode, stc.userbits);
+	return;
+}
+
+/* Runs once a frame from the card's frame interrupt, so the timecode sense
+ * commands that follow are answered without any conversion */
+static void p2slave_build_tc(struct p2slave_t *dev) {
+	timecode_smpte_t stc = timecode_to_smpte(&dev->data.tc);
+	p2slave_reply_build(dev->reply[P2R_LTC], 0x74, 0x04, stc.timecode, 0);
+	p2slave_reply_build(dev->reply[P2R_VITC], 0x74, 0x06, stc.timecode, 0);
+	p2slave_reply_build(dev->reply[P2R_Timer1], 0x74, 0x00, stc.timecode, 0);
+	p2slave_reply_build(dev->reply[P2R_LTCUB], 0x74, 0x05, stc.userbits, 0);
+	p2slave_reply_build(dev->reply[P2R_VITCUB], 0x74, 0x07, stc.userbits, 0);
+	p2slave_reply_build(dev->reply[P2R_LTCTCUB], 0x78, 0x04, stc.timecode, stc.userbits);
+	p2slave_reply_build(dev->reply[P2R_VITCTCUB], 0x78, 0x06, stc.timecode, stc.userbits);
+	dev->tcword = stc.timecode;
+	return;
+}
+
+#define FUNC_BUILD_POINT(name, which, b2)						\
+	static void p2slave_build_##name(struct p2slave_t *dev) {			\
+		timecode_smpte_t stc = timecode_to_smpte(&dev->data.name);		\
+		p2slave_reply_build(dev->reply[which], 0x74, b2, stc.timecode, 0);	\
+		return;									\
+	}
+
+FUNC_BUILD_POINT(in, P2R_In, 0x10);
+FUNC_BUILD_POINT(out, P2R_Out, 0x11);
+FUNC_BUILD_POINT(ain, P2R_AudIn, 0x12);
+FUNC_BUILD_POINT(aout, P2R_AudOut, 0x13);
+FUNC_BUILD_POINT(preroll, P2R_Preroll, 0x31);
+
+static void p2slave_build_speed(struct p2slave_t *dev) {
+	uint8_t *pout = dev->reply[P2R_Speed];
+	pout[0] = 0x71;
+	pout[1] = 0x2E;
+	pout[2] = dev->data.speed;
+	p2slave_checksum_add(pout);
+	return;
+}
+
+/* Builds every reply, for a new device */
+static void p2slave_build_all(struct p2slave_t *dev) {
+	p2slave_build_id(dev);
+	p2slave_build_tcgen(dev);
+	p2slave_build_tc(dev);
+	p2slave_build_in(dev);
+	p2slave_build_out(dev);
+	p2slave_build_ain(dev);
+	p2slave_build_aout(dev);
+	p2slave_build_preroll(dev);
+	p2slave_build_speed(dev);
+	return;
+}
+
+/* Copies 'size' bytes of the device data or replies, retrying if a setter
+ * changed them part way.  Lock free, so the UART interrupt never waits on one */
+static void p2slave_seq_copy(struct p2slave_t *dev, void *dst, const void *src, int size) {
+	unsigned seq;
+	do {
+		seq = read_seqcount_begin(&dev->seq);
+		memcpy(dst, src, size);
+	} while(read_seqcount_retry(&dev->seq, seq));
+	return;
+}
+
+FUNC_SET(id, uint16_t, data, p2slave_build_id(dev));
 FUNC_GET(id, uint16_t);
-FUNC_GET_USER(id);
+FUNC_GET_USER(id, val);
 
-FUNC_SET(status, const struct p2slave_status_t *, *data);
+FUNC_SET(status, const struct p2slave_status_t *, *data, );
 FUNC_GET(status, struct p2slave_status_t);
-FUNC_GET_USER(status);
+FUNC_GET_USER(status, &val);
 
-FUNC_SET(tcgen, const timecode_t *, *data);
+FUNC_SET(tcgen, const timecode_t *, *data, p2slave_build_tcgen(dev));
 FUNC_GET(tcgen, timecode_t);
-FUNC_GET_SMPTE(tcgen);
-FUNC_GET_USER(tcgen);
+FUNC_GET_USER(tcgen, &val);
 
-FUNC_SET(tc, const timecode_t *, *data);
+FUNC_SET(tc, const timecode_t *, *data, p2slave_build_tc(dev));
 FUNC_GET(tc, timecode_t);
-FUNC_GET_SMPTE(tc);
-FUNC_GET_USER(tc);
+FUNC_GET_USER(tc, &val);
 
-FUNC_SET(in, const timecode_t *, *data);
+FUNC_SET(in, const timecode_t *, *data, p2slave_build_in(dev));
 FUNC_GET(in, timecode_t);
-FUNC_GET_SMPTE(in);
-FUNC_GET_USER(in);
+FUNC_GET_USER(in, &val);
 
-FUNC_SET(out, const timecode_t *, *data);
+FUNC_SET(out, const timecode_t *, *data, p2slave_build_out(dev));
 FUNC_GET(out, timecode_t);
-FUNC_GET_SMPTE(out);
-FUNC_GET_USER(out);
+FUNC_GET_USER(out, &val);
 
-FUNC_SET(ain, const timecode_t *, *data);
+FUNC_SET(ain, const timecode_t *, *data, p2slave_build_ain(dev));
 FUNC_GET(ain, timecode_t);
-FUNC_GET_SMPTE(ain);
-FUNC_GET_USER(ain);
+FUNC_GET_USER(ain, &val);
 
-FUNC_SET(aout, const timecode_t *, *data);
+FUNC_SET(aout, const timecode_t *, *data, p2slave_build_aout(dev));
 FUNC_GET(aout, timecode_t);
-FUNC_GET_SMPTE(aout);
-FUNC_GET_USER(aout);
+FUNC_GET_USER(aout, &val);
 
-FUNC_SET(preroll, const timecode_t *, *data);
+FUNC_SET(preroll, const timecode_t *, *data, p2slave_build_preroll(dev));
 FUNC_GET(preroll, timecode_t);
-FUNC_GET_SMPTE(preroll);
-FUNC_GET_USER(preroll);
+FUNC_GET_USER(preroll, &val);
 
-FUNC_SET(speed, int, data);
+FUNC_SET(speed, int, data, p2slave_build_speed(dev));
 FUNC_GET(speed, int);
-FUNC_GET_USER(speed);
+FUNC_GET_USER(speed, val);
 
 static int p2slave_pkt_size(const uint8_t *data) {
 	return (data[0] & 0x0F) + 3;
@@ -209,71 +353,58 @@ static void p2slave_handlepkt_log(const uint8_t *pin, const uint8_t *pout) {
 	return;
 }
 
-/* Pushes the packet onto the buffer */
+/* Packets in the ring the reader hasn't taken.  A reader that moved its index
+ * somewhere silly gets the whole ring */
+static uint32_t p2slave_ring_pending(struct p2slave_t *dev) {
+	uint32_t n = dev->ring_write - dev->ring->read;
+	return n > dev->ring_slots ? dev->ring_slots : n;
+}
+
+/* Pushes the packet onto the ring.  Each device has one producer (the card UART
+ * interrupt or its tty), so the only shared index is the reader's.  A full ring
+ * drops the new packet and counts it rather than overwriting unread ones */
 static void p2slave_pushpkt(struct p2slave_t *dev, const uint8_t *data, int size) {
-	if(atomic_read(&dev->opens)) {
-		int wp = dev->buffer.write;
-		struct p2slave_pkt_t *pkt = &dev->buffer.buf[wp];
-		do_gettimeofday(&pkt->tstamp);
-		memcpy((void *)pkt->data, (const void *)data, size);
-		
-		/* Increment the write pointer */
-		wp++; if(wp >= P2SLAVE_BUFSIZE) wp = 0;
-		dev->buffer.write = wp;
-
-		/* Wake up the buffer wait queue */
+	struct p2slave_ring_t 	*ring = dev->ring;
+	uint32_t 		wp = dev->ring_write;
+	struct p2slave_pkt_t 	*pkt;
+
+	if(!atomic_read(&dev->opens)) return;
+
+	if(wp - ACCESS_ONCE(ring->read) >= dev->ring_slots) {
+		ring->overflows = ++dev->stats.overflows;
 		wake_up_interruptible(&dev->wait);
+		return;
 	}
-	return;
-}
 
-static uint8_t p2slave_checksum(const uint8_t *data, int size) {
-	int i;
-	uint8_t csum = 0;
-	for(i = 0; i < size; i++) csum += *data++;
-	return csum;
-}
+	/* The reader is done with the slot once it moves 'read' past it, so the slot
+	 * can't be written before that read */
+	smp_mb();
+	pkt = &ring->pkt[wp & (dev->ring_slots - 1)];
+	pkt->tstamp = rawclock_ns();
+	memcpy((void *)pkt->data, (const void *)data, size);
 
-static void p2slave_checksum_add(uint8_t *data) {
-	int size = (data[0] & 0x0F) + 2; // This is the size BEFORE the checksum
-	uint8_t csum = p2slave_checksum(data, size);
-	data[size] = csum;
-	return;
-}
+	/* The packet has to be there before the reader sees the index */
+	smp_wmb();
+	ring->write = dev->ring_write = wp + 1;
 
-static int p2slave_checksum_verify(const uint8_t *data) {
-	int size = (data[0] & 0x0F) + 2; // This is the size BEFORE the checksum
-	uint8_t csum = p2slave_checksum(data, size);
-	return(csum != data[size]);
+	/* Wake up the buffer wait queue */
+	wake_up_interruptible(&dev->wait);
+	return;
 }
 
-#define SETPKT_INT(b1, b2, i1)		pout[0] = b1; \
-					pout[1] = b2; \
-					pout[2] = i1 & 0xFF; \
-					pout[3] = (i1 >> 8) & 0xFF; \
-					pout[4] = (i1 >> 16) & 0xFF; \
-					pout[5] = (i1 >> 24) & 0xFF; \
-					sendack = 0
-
-#define SETPKT_2INT(b1, b2, i1, i2) 	pout[0] = b1; \
-					pout[1] = b2; \
-					pout[2] = i1 & 0xFF; \
-					pout[3] = (i1 >> 8) & 0xFF; \
-					pout[4] = (i1 >> 16) & 0xFF; \
-					pout[5] = (i1 >> 24) & 0xFF; \
-					pout[6] = i2 & 0xFF; \
-					pout[7] = (i2 >> 8) & 0xFF; \
-					pout[8] = (i2 >> 16) & 0xFF; \
-					pout[9] = (i2 >> 24) & 0xFF; \
-					sendack = 0
-
 #define SETPKT(obj) 			memcpy(pout, obj, sizeof(obj)); \
 					sendack = 0
 
+/* Answers with a prebuilt sense reply */
+#define SETPKT_REPLY(which) 		p2slave_seq_copy(dev, pout, dev->reply[which], P2SLAVE_REPLYSIZE); \
+					sendack = 0; \
+					csum = 0
+
 int p2slave_handle_pkt(struct p2slave_t *dev, uint8_t *pout, const uint8_t *pin) {
 	int cmd, size;
 	int sendack = 1; /* If this is set, respond with the default ACK */
 	int usersend = 1; /* If this is set, the packet will not be forwarded to userspace. */
+	int csum = 1; /* If this is set, the response still needs its checksum */
 
 	dev->stats.count++;
 
@@ -290,99 +421,83 @@ int p2slave_handle_pkt(struct p2slave_t *dev, uint8_t *pout, const uint8_t *pin)
 
 	/* Catch any commands that need to return data */
 	switch(cmd) {
-		case 0x0011: { /* Device Type Request */
-				     uint16_t id = p2slave_get_id(dev);
-				     uint8_t pret[] = {0x12, 0x11, (id >> 8) & 0xFF, id & 0xFF};
-				     SETPKT(pret);
-			     }
+		case 0x0011: /* Device Type Request */
+			     SETPKT_REPLY(P2R_DevType);
 			     usersend = 0;
 			     break;
 
-		case 0x600A: { /* Timecode Generator Sense */
-				     uint8_t type = pin[2];
-				     timecode_smpte_t stc = p2slave_get_smpte_tcgen(dev);
-				     switch(type) {
-					     case 0x01: /* Timecode */
-						     SETPKT_INT(0x74, 0x08, stc.timecode); break;
+		case 0x600A: /* Timecode Generator Sense */
+			     switch(pin[2]) {
+				     case 0x01: /* Timecode */
+					     SETPKT_REPLY(P2R_GenTC); break;
 
-					     case 0x10: /* Userbits */
-						     SETPKT_INT(0x74, 0x09, stc.userbits); break;
+				     case 0x10: /* Userbits */
+					     SETPKT_REPLY(P2R_GenUB); break;
 
-					     case 0x11: /* Timecode and Userbits */
-						     SETPKT_2INT(0x78, 0x08, stc.timecode, stc.userbits); break;
-				     }
+				     case 0x11: /* Timecode and Userbits */
+					     SETPKT_REPLY(P2R_GenTCUB); break;
 			     }
 			     usersend = 0;
 			     break;
 
-		case 0x600C: { /* Timecode Sense */
-				     uint8_t type = pin[2];
-				     timecode_smpte_t stc = p2slave_get_smpte_tc(dev);
-
-				     switch(type) {
-					     case 0x01: /* LTC Timecode */
-					     case 0x03: /* LTC or VITC timecode */
-						     SETPKT_INT(0x74, 0x04, stc.timecode); break;
+		case 0x600C: /* Timecode Sense */
+			     switch(pin[2]) {
+				     case 0x01: /* LTC Timecode */
+				     case 0x03: /* LTC or VITC timecode */
+					     SETPKT_REPLY(P2R_LTC); break;
 
-					     case 0x02: /* VITC Timecode */
-						     SETPKT_INT(0x74, 0x06, stc.timecode); break;
+				     case 0x02: /* VITC Timecode */
+					     SETPKT_REPLY(P2R_VITC); break;
 
-					     case 0x04: /* Timer1 Timecode */
-						     SETPKT_INT(0x74, 0x00, stc.timecode); break;
+				     case 0x04: /* Timer1 Timecode */
+					     SETPKT_REPLY(P2R_Timer1); break;
 
-					     case 0x10: /* LTC Userbits */
-					     case 0x30: /* LTC or VITC userbits */
-						     SETPKT_INT(0x74, 0x05, stc.userbits); break;
+				     case 0x10: /* LTC Userbits */
+				     case 0x30: /* LTC or VITC userbits */
+					     SETPKT_REPLY(P2R_LTCUB); break;
 
-					     case 0x20: /* VITC Userbits */
-						     SETPKT_INT(0x74, 0x07, stc.userbits); break;
+				     case 0x20: /* VITC Userbits */
+					     SETPKT_REPLY(P2R_VITCUB); break;
 
-					     case 0x11: /* LTC Timecode and Userbits */
-					     case 0x33: /* LTC or VITC timecode and userbits */
-						     SETPKT_2INT(0x78, 0x04, stc.timecode, stc.userbits); break;
+				     case 0x11: /* LTC Timecode and Userbits */
+				     case 0x33: /* LTC or VITC timecode and userbits */
+					     SETPKT_REPLY(P2R_LTCTCUB); break;
 
-					     case 0x22: /* VITC timecode and userbits */
-						     SETPKT_2INT(0x78, 0x06, stc.timecode, stc.userbits); break;
-				     }
+				     case 0x22: /* VITC timecode and userbits */
+					     SETPKT_REPLY(P2R_VITCTCUB); break;
 			     }
 			     usersend = 0;
 			     break;
 
-		case 0x6010: { /* In Data Sense */
-				     timecode_smpte_t stc = p2slave_get_smpte_in(dev);
-				     SETPKT_INT(0x74, 0x10, stc.timecode);
-			     }
+		case 0x6010: /* In Data Sense */
+			     SETPKT_REPLY(P2R_In);
 			     usersend = 0;
 			     break;
 
-		case 0x6011: { /* Out Data Sense */
-				     timecode_smpte_t stc = p2slave_get_smpte_out(dev);
-				     SETPKT_INT(0x74, 0x11, stc.timecode);
-			     }
+		case 0x6011: /* Out Data Sense */
+			     SETPKT_REPLY(P2R_Out);
 			     usersend = 0;
 			     break;
 
-		case 0x6012: { /* Audio In Data Sense */
-				     timecode_smpte_t stc = p2slave_get_smpte_ain(dev);
-				     SETPKT_INT(0x74, 0x12, stc.timecode);
-			     }
+		case 0x6012: /* Audio In Data Sense */
+			     SETPKT_REPLY(P2R_AudIn);
 			     usersend = 0;
 			     break;
 
-		case 0x6013: { /* Audio Out Data Sense */
-				     timecode_smpte_t stc = p2slave_get_smpte_aout(dev);
-				     SETPKT_INT(0x74, 0x13, stc.timecode);
-			     }
+		case 0x6013: /* Audio Out Data Sense */
+			     SETPKT_REPLY(P2R_AudOut);
 			     usersend = 0;
 			     break;
 
 		case 0x6020: { /* Status Sense */
-				     struct p2slave_status_t status = p2slave_get_status(dev);
 				     uint8_t start = (pin[2] & 0xF0) >> 4;
 				     uint8_t len = (pin[2] & 0x0F);
+				     uint8_t have = sizeof(struct p2slave_status_t) - start;
 				     pout[0] = 0x70 | len;
 				     pout[1] = 0x20;
-				     memcpy((void *)pout + 2, (const void *)&status + start, len);
+				     /* Bytes past the end of the status data read as zero */
+				     if(len > have) memset((void *)pout + 2 + have, 0, len - have);
+				     p2slave_seq_copy(dev, pout + 2, dev->data.status.data + start, len > have ? have : len);
 				     sendack = 0;
 			     }
 			     /* Always send the status sense packets to userspace to make sure
@@ -390,19 +505,13 @@ int p2slave_handle_pkt(struct p2slave_t *dev, uint8_t *pout, const uint8_t *pin)
 			     usersend = 1;
 			     break;
 
-		case 0x602E: { /* Command Speed Sense */
-				     pout[0] = 0x71;
-				     pout[1] = 0x2E;
-				     pout[2] = p2slave_get_speed(dev);
-				     sendack = 0;
-			     }
+		case 0x602E: /* Command Speed Sense */
+			     SETPKT_REPLY(P2R_Speed);
 			     usersend = 0;
 			     break;
 
-		case 0x6031: { /* Preroll sense */
-				     timecode_smpte_t stc = p2slave_get_smpte_preroll(dev);
-				     SETPKT_INT(0x74, 0x31, stc.timecode);
-			     }
+		case 0x6031: /* Preroll sense */
+			     SETPKT_REPLY(P2R_Preroll);
 			     usersend = 0;
 			     break;
 
@@ -417,34 +526,18 @@ int p2slave_handle_pkt(struct p2slave_t *dev, uint8_t *pout, const uint8_t *pin)
 
 		/* Edit On/Off are special cases.  We modify the packet we are going to send to userspace
 		 * to include the current timecode.  This is used to ensure that the edit timing is correct */
-		case 0x2064: { /* Edit On */
-				     timecode_smpte_t 	stc = p2slave_get_smpte_tc(dev);
-				     uint8_t 		npkt[8];
-				     
-				     npkt[0] = 0x24;
-				     npkt[1] = 0x64;
-				     npkt[2] = stc.timecode & 0xFF;
-				     npkt[3] = (stc.timecode >> 8) & 0xFF;
-				     npkt[4] = (stc.timecode >> 16) & 0xFF;
-				     npkt[5] = (stc.timecode >> 24) & 0xFF;
-				     
-				     /* Now push the new packet to the user */
-				     p2slave_pushpkt(dev, npkt, 6);
-			     }
-			     usersend = 0;
-			     sendack = 1;
-			     break; 
-
+		case 0x2064: /* Edit On */
 		case 0x2065: { /* Edit Off */
-				     timecode_smpte_t 	stc = p2slave_get_smpte_tc(dev);
+				     uint32_t 		tcword;
 				     uint8_t 		npkt[8];
-				     
+
+				     p2slave_seq_copy(dev, &tcword, &dev->tcword, sizeof(tcword));
 				     npkt[0] = 0x24;
-				     npkt[1] = 0x65;
-				     npkt[2] = stc.timecode & 0xFF;
-				     npkt[3] = (stc.timecode >> 8) & 0xFF;
-				     npkt[4] = (stc.timecode >> 16) & 0xFF;
-				     npkt[5] = (stc.timecode >> 24) & 0xFF;
+				     npkt[1] = pin[1];
+				     npkt[2] = tcword & 0xFF;
+				     npkt[3] = (tcword >> 8) & 0xFF;
+				     npkt[4] = (tcword >> 16) & 0xFF;
+				     npkt[5] = (tcword >> 24) & 0xFF;
 				     
 				     /* Now push the new packet to the user */
 				     p2slave_pushpkt(dev, npkt, 6);
@@ -461,7 +554,7 @@ int p2slave_handle_pkt(struct p2slave_t *dev, uint8_t *pout, const uint8_t *pin)
 	if(usersend) p2slave_pushpkt(dev, pin, size);
 
 	/* Add the checksum to the outgoing packet */
-	p2slave_checksum_add(pout);
+	if(csum) p2slave_checksum_add(pout);
 	if(dev->flags & P2S_Debug) p2slave_handlepkt_log(pin, pout);
 	return 0;
 }
@@ -477,6 +570,18 @@ static struct p2slave_t *p2slave_allocate(const char *name) {
 	strncpy(dev->name, name, sizeof(dev->name));
 	spin_lock_init(&dev->datalock);
 	init_waitqueue_head(&dev->wait);
+	seqcount_init(&dev->seq);
+	p2slave_build_all(dev);
+
+	dev->ring_slots = roundup_pow_of_two(ring_slots < 2 ? 2 : ring_slots);
+	dev->ring_bytes = PAGE_ALIGN(sizeof(struct p2slave_ring_t) + dev->ring_slots * sizeof(struct p2slave_pkt_t));
+	dev->ring = (struct p2slave_ring_t *)vmalloc_user(dev->ring_bytes);
+	if(dev->ring == NULL) {
+		perror("Failed to allocate a %d packet ring for %s\n", dev->ring_slots, name);
+		kfree(dev);
+		return NULL;
+	}
+	dev->ring->slots = dev->ring_slots;
 
 	spin_lock(&spinlock);
 	for(i = 0; i < MAX_DEVS; i++) {
@@ -490,6 +595,7 @@ static struct p2slave_t *p2slave_allocate(const char *name) {
 
 	if(i == MAX_DEVS) {
 		perror("Failed to find a free device slot for %s\n", name);
+		vfree(dev->ring);
 		kfree(dev);
 		return NULL;
 	}
@@ -500,13 +606,14 @@ static void p2slave_free(struct p2slave_t *dev) {
 	spin_lock(&spinlock);
 	devs[dev->index] = NULL;
 	spin_unlock(&spinlock);
+	vfree(dev->ring);	// Pages a process still has mapped stay until it unmaps them
 	kfree(dev);
 	return;
 }
 
+/* Skips anything left in the ring from an earlier open */
 static void p2slave_buffer_reset(struct p2slave_t *dev) {
-	dev->buffer.read = 0;
-	dev->buffer.write = 0;
+	dev->ring->read = dev->ring_write;
 	return;
 }
 
@@ -531,27 +638,36 @@ static int p2slave_release(struct inode *inode, struct file *filp) {
 
 static ssize_t p2slave_read(struct file *filp, char __user *buf, size_t count, loff_t *f_pos) {
 	struct p2slave_t 	*dev = (struct p2slave_t *)filp->private_data;
-	int 			rp, total = 0;
+	struct p2slave_ring_t 	*ring = dev->ring;
+	uint32_t 		wp, rp, n, run;
+
+	if(count < sizeof(struct p2slave_pkt_t)) return -EINVAL;
 
 	/* Wait until we have data in the buffer */
-	while(dev->buffer.read == dev->buffer.write) {
+	while(!p2slave_ring_pending(dev)) {
 		if(filp->f_flags & O_NONBLOCK) return -EAGAIN;
-		if(wait_event_interruptible(dev->wait, dev->buffer.read != dev->buffer.write))
+		if(wait_event_interruptible(dev->wait, p2slave_ring_pending(dev)))
 			return -ERESTARTSYS;
 	}
 
-	rp = dev->buffer.read;
-	while(rp != dev->buffer.write) {
-		/* Make sure there is enough room */
-		if(total + sizeof(struct p2slave_pkt_t) > count) break;
-		if(copy_to_user(buf, &dev->buffer.buf[rp], sizeof(struct p2slave_pkt_t))) return -EIO;
-		total += sizeof(struct p2slave_pkt_t);
-		buf += sizeof(struct p2slave_pkt_t);
-		rp++; if(rp >= P2SLAVE_BUFSIZE) rp = 0;
-	}
-	dev->buffer.read = rp;
-	if(!total) perror("Read is returning 0.\n");
-	return total;
+	/* The producer may be adding packets, so work from one look at its index */
+	wp = ACCESS_ONCE(dev->ring_write);
+	n = wp - ring->read;
+	if(n > dev->ring_slots) n = dev->ring_slots;
+	rp = wp - n;
+	if(n > count / sizeof(struct p2slave_pkt_t)) n = count / sizeof(struct p2slave_pkt_t);
+	smp_rmb();
+
+	/* At most two copies, up to the end of the ring and then from the start */
+	run = dev->ring_slots - (rp & (dev->ring_slots - 1));
+	if(run > n) run = n;
+	if(copy_to_user(buf, &ring->pkt[rp & (dev->ring_slots - 1)], run * sizeof(struct p2slave_pkt_t))) return -EFAULT;
+	if(n > run && copy_to_user(buf + run * sizeof(struct p2slave_pkt_t), ring->pkt, (n - run) * sizeof(struct p2slave_pkt_t))) return -EFAULT;
+
+	/* Done with the slots before the producer can reuse them */
+	smp_mb();
+	ring->read = rp + n;
+	return n * sizeof(struct p2slave_pkt_t);
 }
 
 static int p2slave_ioctl(struct inode *inode, struct file *filp, unsigned int cmd, unsigned long arg) {
@@ -569,6 +685,7 @@ static int p2slave_ioctl(struct inode *inode, struct file *filp, unsigned int cm
 		case P2SLAVE_IOC_SETAOUT:	ret = p2slave_get_user_aout(dev, arg); break; 
 		case P2SLAVE_IOC_SETPREROLL:	ret = p2slave_get_user_preroll(dev, arg); break;
 		case P2SLAVE_IOC_SETSPEED:	ret = p2slave_get_user_speed(dev, arg); break;
+		case P2SLAVE_IOC_RINGSIZE: 	ret = put_user(dev->ring_bytes, (uint32_t __user *)arg); break;
 
 		default: return -ENOTTY; break;
 	}
@@ -583,18 +700,26 @@ unsigned int p2slave_poll(struct file *filp, poll_table *wait) {
 	poll_wait(filp, &dev->wait, wait);
 
 	/* Let the poll know if we can read */
-	if (dev->buffer.read != dev->buffer.write) 
+	if (p2slave_ring_pending(dev)) 
 		mask |= POLLIN | POLLRDNORM;
 
 	return mask;
 }
 
+/* Maps the packet ring, see struct p2slave_ring_t */
+static int p2slave_mmap(struct file *filp, struct vm_area_struct *vma) {
+	struct p2slave_t 	*dev = (struct p2slave_t *)filp->private_data;
+	if(vma->vm_pgoff || vma->vm_end - vma->vm_start > dev->ring_bytes) return -EINVAL;
+	return remap_vmalloc_range(vma, dev->ring, 0);
+}
+
 struct file_operations p2slave_fops = {
          .owner =	THIS_MODULE,
 	 .open =	p2slave_open,
          .release =	p2slave_release,
          .read =	p2slave_read,
 	 .ioctl = 	p2slave_ioctl,
+	 .mmap = 	p2slave_mmap,
 	 .poll =	p2slave_poll
 };
 
@@ -608,9 +733,15 @@ static ssize_t p2slave_show_stats(struct device *dev, struct device_attribute *a
 	struct p2slave_t *p2s = (struct p2slave_t *)dev_get_drvdata(dev);
 	return snprintf(buf, PAGE_SIZE, 
 			"Total pkts: %d\n"
-			"CRC Errors: %d\n",
+			"CRC Errors: %d\n"
+			"Line Errors: %d\n"
+			"Timeouts: %d\n"
+			"Overflows: %d\n",
 			p2s->stats.count, 
-			p2s->stats.err_crc
+			p2s->stats.err_crc,
+			p2s->stats.err_line,
+			p2s->stats.err_timeout,
+			p2s->stats.overflows
 		);
 }
 DEVICE_ATTR(stats, 0444, p2slave_show_stats, NULL);
@@ -670,7 +801,133 @@ regfail:
 }
 EXPORT_SYMBOL(p2slave_register);
 
+/*****************************************************************************/
+/* LINE DISCIPLINE                                                           */
+/*****************************************************************************/
+
+/* The p2slave line discipline answers P2 commands from any tty (a USB or PCIe
+ * RS-422 port) in kernel context, the same way the AJA card UART does.  Attaching
+ * it creates a p2slave device for the port, which works like a card's. */
+struct p2slave_tty_t {
+	struct tty_struct 		*tty;
+	struct p2slave_t 		*dev;
+	spinlock_t 			lock;			// Receive and transmit state
+	uint8_t 			in[P2SLAVE_PKTSIZE];	// Command being received
+	uint8_t 			out[P2SLAVE_PKTSIZE];	// Reply being sent
+	int 				inpt;			// Command bytes received
+	int 				outpt;			// Reply bytes written
+	int 				outsize;		// Reply size, 0 if none is pending
+	int64_t 			rx_byte;		// Time of the last received bytes, ns
+};
+
+/* Writes as much of the reply as the tty takes, the rest goes from write_wakeup */
+static void p2slave_tty_send(struct p2slave_tty_t *pt) {
+	int n;
+	if(pt->outpt >= pt->outsize) return;
+	n = TTY_WRITE(pt->tty, pt->out + pt->outpt, pt->outsize - pt->outpt);
+	if(n > 0) pt->outpt += n;
+	if(pt->outpt < pt->outsize) {
+		set_bit(TTY_DO_WRITE_WAKEUP, &pt->tty->flags);
+	} else {
+		clear_bit(TTY_DO_WRITE_WAKEUP, &pt->tty->flags);
+		pt->outpt = pt->outsize = 0;
+	}
+	return;
+}
+
+static void p2slave_tty_receive(struct tty_struct *tty, const unsigned char *cp, char *fp, int count) {
+	struct p2slave_tty_t 	*pt = (struct p2slave_tty_t *)tty->disc_data;
+	int64_t 		now = rawclock_ns();
+	unsigned long 		flags;
+	int 			i;
+
+	if(pt == NULL) return;
+	spin_lock_irqsave(&pt->lock, flags);
+
+	// The master has given up on a command that stopped part way
+	if(pt->inpt && now - pt->rx_byte > P2SLAVE_TTY_TIMEOUT) {
+		pt->inpt = 0;
+		pt->dev->stats.err_timeout++;
+	}
+	pt->rx_byte = now;
+
+	for(i = 0; i < count; i++) {
+		if(fp && fp[i] != TTY_NORMAL) {
+			pt->inpt = 0;
+			pt->dev->stats.err_line++;
+			continue;
+		}
+		pt->in[pt->inpt++] = cp[i];
+		if(pt->inpt < p2slave_pkt_size(pt->in)) continue;
+
+		// Ok, we have a full packet.  Parse it and transmit the response.
+		p2slave_handle_pkt(pt->dev, pt->out, pt->in);
+		pt->outsize = p2slave_pkt_size(pt->out);
+		pt->outpt = 0;
+		pt->inpt = 0;
+		p2slave_tty_send(pt);
+	}
+	spin_unlock_irqrestore(&pt->lock, flags);
+	return;
+}
+
+static void p2slave_tty_wakeup(struct tty_struct *tty) {
+	struct p2slave_tty_t 	*pt = (struct p2slave_tty_t *)tty->disc_data;
+	unsigned long 		flags;
+	if(pt == NULL) return;
+	spin_lock_irqsave(&pt->lock, flags);
+	p2slave_tty_send(pt);
+	spin_unlock_irqrestore(&pt->lock, flags);
+	return;
+}
+
+static int p2slave_tty_open(struct tty_struct *tty) {
+	struct p2slave_tty_t *pt = (struct p2slave_tty_t *)kzalloc(sizeof(struct p2slave_tty_t), GFP_KERNEL);
+	if(pt == NULL) return -ENOMEM;
+	spin_lock_init(&pt->lock);
+	pt->tty = tty;
+	pt->dev = p2slave_register(tty->name);
+	if(pt->dev == NULL) {
+		kfree(pt);
+		return -ENODEV;
+	}
+	tty->disc_data = pt;
+	tty->receive_room = 65536;
+	return 0;
+}
+
+static void p2slave_tty_close(struct tty_struct *tty) {
+	struct p2slave_tty_t *pt = (struct p2slave_tty_t *)tty->disc_data;
+	if(pt == NULL) return;
+	tty->disc_data = NULL;
+	p2slave_unregister(pt->dev);
+	kfree(pt);
+	return;
+}
+
+static int p2slave_tty_ioctl(struct tty_struct *tty, struct file *filp, unsigned int cmd, unsigned long arg) {
+	struct p2slave_tty_t *pt = (struct p2slave_tty_t *)tty->disc_data;
+	if(pt == NULL) return -ENODEV;
+	switch(cmd) {
+		case P2SLAVE_TIOCGINDEX: 	return put_user(pt->dev->index, (int __user *)arg);
+		default: 			return -ENOIOCTLCMD;
+	}
+}
+
+static TTY_LDISC_T p2slave_ldisc = {
+	.owner = 		THIS_MODULE,
+	.magic = 		TTY_LDISC_MAGIC,
+	.name = 		MODNAME,
+	.open = 		p2slave_tty_open,
+	.close = 		p2slave_tty_close,
+	.ioctl = 		p2slave_tty_ioctl,
+	.receive_buf = 		p2slave_tty_receive,
+	.write_wakeup = 	p2slave_tty_wakeup
+};
+
 static void p2slave_cleanup(void) {
+	if(ldisc_registered) tty_unregister_ldisc(ldisc);
+	ldisc_registered = 0;
 	if(chrdev) unregister_chrdev_region(chrdev, 256);
 	if(class != NULL) CLASS_DESTROY(class);
 	return;
@@ -695,6 +952,23 @@ int p2slave_init(void) {
 		perror("Failed to allocate char device with %d\n", error);
 		goto initfail;
 	}
+
+	// A bad line discipline number only loses the tty backend, not the cards
+	if(ldisc < 0) {
+		pinfo("tty line discipline not registered, load with ldisc=<n> to use it\n");
+	} else if(ldisc <= N_TTY || ldisc >= NR_LDISCS) {
+		perror("Line discipline %d is out of range, it must be %d to %d\n", ldisc, N_TTY + 1, NR_LDISCS - 1);
+		ldisc = -1;
+	} else {
+		int ret = tty_register_ldisc(ldisc, &p2slave_ldisc);
+		if(ret) {
+			perror("Failed to register line discipline %d with %d\n", ldisc, ret);
+			ldisc = -1;
+		} else {
+			pinfo("tty line discipline registered as %d\n", ldisc);
+			ldisc_registered = 1;
+		}
+	}
 	return 0;
 
 initfail:
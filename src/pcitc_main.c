@@ -78,6 +78,7 @@ struct pcitc_t {
 	struct pci_dev 		*pcidev; 		/* PCI device */
 	struct pcitc_dops_t 	*ops;			/* Device low level operations structure */
 	int 			cfps;			/* Current Frame Rate */
+	spinlock_t 		lock;			/* Serializes card accesses, sync comes from a hard IRQ */
 };
 
 
@@ -454,15 +455,25 @@ int pcitc_setup(struct pcitc_t *card, int fps) {
 	return 0;
 }
 
+/* The tcio entry points below hold card->lock for the whole operation.  On the
+ * PCIe card every register access is a multi step CMD52 transaction, so a sync
+ * pulse from the hard IRQ must not land inside a mailbox exchange or a read */
 int pcitc_run(void *dev, int val) {
 	struct pcitc_t *card = (struct pcitc_t *)dev;
-	int ret = (val) ? pcitc_mailbox_send(card, 0x4E) :  pcitc_mailbox_send(card, 0x4D);
+	unsigned long flags;
+	int ret;
+	spin_lock_irqsave(&card->lock, flags);
+	ret = (val) ? pcitc_mailbox_send(card, 0x4E) :  pcitc_mailbox_send(card, 0x4D);
+	spin_unlock_irqrestore(&card->lock, flags);
 	return (ret < 0) ? -EIO : 0;
 }
 
 int pcitc_sync(void *dev, int val) {
 	struct pcitc_t *card = (struct pcitc_t *)dev;
+	unsigned long flags;
+	spin_lock_irqsave(&card->lock, flags);
 	card->ops->write8(card, 0xBF, val ? 0x81 : 0x80);
+	spin_unlock_irqrestore(&card->lock, flags);
 	return 0;
 }
 
@@ -510,8 +521,7 @@ int pcitc_readtcgen(struct pcitc_t *card, timecode_t *tc) {
 	return 0;
 }
 
-int pcitc_read(void *dev, timecode_t *tc) {
-	struct pcitc_t 		*card = (struct pcitc_t *)dev;
+static int pcitc_read_locked(struct pcitc_t *card, timecode_t *tc) {
 	uint8_t 		rate;
 	uint8_t 		d1, d2, flags;
 	uint32_t 		tcode, ubits;
@@ -556,8 +566,17 @@ int pcitc_read(void *dev, timecode_t *tc) {
 	return 0;
 }
 
-int pcitc_write(void *dev, const timecode_t *tc) {
+int pcitc_read(void *dev, timecode_t *tc) {
 	struct pcitc_t 		*card = (struct pcitc_t *)dev;
+	unsigned long 		flags;
+	int 			ret;
+	spin_lock_irqsave(&card->lock, flags);
+	ret = pcitc_read_locked(card, tc);
+	spin_unlock_irqrestore(&card->lock, flags);
+	return ret;
+}
+
+static int pcitc_write_locked(struct pcitc_t *card, const timecode_t *tc) {
 	struct pcitc_dops_t 	*ops = card->ops;
 	int 			ret;
 	timecode_smpte_t 	stc;
@@ -591,6 +610,16 @@ int pcitc_write(void *dev, const timecode_t *tc) {
 	return (ret < 0) ? -EIO : 0;
 }
 
+int pcitc_write(void *dev, const timecode_t *tc) {
+	struct pcitc_t 		*card = (struct pcitc_t *)dev;
+	unsigned long 		flags;
+	int 			ret;
+	spin_lock_irqsave(&card->lock, flags);
+	ret = pcitc_write_locked(card, tc);
+	spin_unlock_irqrestore(&card->lock, flags);
+	return ret;
+}
+
 #if 0
 static ssize_t pcitc_show_genstatus(struct class_device *cls, char *buf) {
 	pcitc_t 	*card = (pcitc_t *)cls->class_data;
@@ -687,6 +716,7 @@ static int pcitc_pci_probe(struct pci_dev *dev, const struct pci_device_id *id)
 	}
 	pci_set_drvdata(dev, (void *)card);
 	memset(card, 0, sizeof(*card));
+	spin_lock_init(&card->lock);
 	card->id = cardct++;
 	snprintf(card->name, TCIO_NAME_MAX, "pcitc%d", card->id);
 	card->pcidev = dev;